@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oms-core.dir/src/main.cpp.o"
+  "CMakeFiles/oms-core.dir/src/main.cpp.o.d"
+  "oms-core"
+  "oms-core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oms-core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
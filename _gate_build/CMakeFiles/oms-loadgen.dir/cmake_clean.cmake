@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oms-loadgen.dir/engine/order_manager.cpp.o"
+  "CMakeFiles/oms-loadgen.dir/engine/order_manager.cpp.o.d"
+  "CMakeFiles/oms-loadgen.dir/src/loadgen_main.cpp.o"
+  "CMakeFiles/oms-loadgen.dir/src/loadgen_main.cpp.o.d"
+  "oms-loadgen"
+  "oms-loadgen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oms-loadgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oms-replay.dir/src/replay_main.cpp.o"
+  "CMakeFiles/oms-replay.dir/src/replay_main.cpp.o.d"
+  "oms-replay"
+  "oms-replay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oms-replay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/src/async_logger.cpp" "CMakeFiles/oms_core_lib.dir/src/async_logger.cpp.o" "gcc" "CMakeFiles/oms_core_lib.dir/src/async_logger.cpp.o.d"
+  "/root/repo/core/src/market_data_capture.cpp" "CMakeFiles/oms_core_lib.dir/src/market_data_capture.cpp.o" "gcc" "CMakeFiles/oms_core_lib.dir/src/market_data_capture.cpp.o.d"
+  "/root/repo/core/src/order_journal.cpp" "CMakeFiles/oms_core_lib.dir/src/order_journal.cpp.o" "gcc" "CMakeFiles/oms_core_lib.dir/src/order_journal.cpp.o.d"
+  "/root/repo/core/src/risk/risk_engine.cpp" "CMakeFiles/oms_core_lib.dir/src/risk/risk_engine.cpp.o" "gcc" "CMakeFiles/oms_core_lib.dir/src/risk/risk_engine.cpp.o.d"
+  "/root/repo/core/src/shm_transport.cpp" "CMakeFiles/oms_core_lib.dir/src/shm_transport.cpp.o" "gcc" "CMakeFiles/oms_core_lib.dir/src/shm_transport.cpp.o.d"
+  "/root/repo/core/src/strategies/arbitrage_detector.cpp" "CMakeFiles/oms_core_lib.dir/src/strategies/arbitrage_detector.cpp.o" "gcc" "CMakeFiles/oms_core_lib.dir/src/strategies/arbitrage_detector.cpp.o.d"
+  "/root/repo/core/src/strategies/market_maker.cpp" "CMakeFiles/oms_core_lib.dir/src/strategies/market_maker.cpp.o" "gcc" "CMakeFiles/oms_core_lib.dir/src/strategies/market_maker.cpp.o.d"
+  "/root/repo/core/src/strategies/triangular_detector.cpp" "CMakeFiles/oms_core_lib.dir/src/strategies/triangular_detector.cpp.o" "gcc" "CMakeFiles/oms_core_lib.dir/src/strategies/triangular_detector.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
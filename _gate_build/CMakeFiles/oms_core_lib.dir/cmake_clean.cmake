@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oms_core_lib.dir/src/async_logger.cpp.o"
+  "CMakeFiles/oms_core_lib.dir/src/async_logger.cpp.o.d"
+  "CMakeFiles/oms_core_lib.dir/src/market_data_capture.cpp.o"
+  "CMakeFiles/oms_core_lib.dir/src/market_data_capture.cpp.o.d"
+  "CMakeFiles/oms_core_lib.dir/src/order_journal.cpp.o"
+  "CMakeFiles/oms_core_lib.dir/src/order_journal.cpp.o.d"
+  "CMakeFiles/oms_core_lib.dir/src/risk/risk_engine.cpp.o"
+  "CMakeFiles/oms_core_lib.dir/src/risk/risk_engine.cpp.o.d"
+  "CMakeFiles/oms_core_lib.dir/src/shm_transport.cpp.o"
+  "CMakeFiles/oms_core_lib.dir/src/shm_transport.cpp.o.d"
+  "CMakeFiles/oms_core_lib.dir/src/strategies/arbitrage_detector.cpp.o"
+  "CMakeFiles/oms_core_lib.dir/src/strategies/arbitrage_detector.cpp.o.d"
+  "CMakeFiles/oms_core_lib.dir/src/strategies/market_maker.cpp.o"
+  "CMakeFiles/oms_core_lib.dir/src/strategies/market_maker.cpp.o.d"
+  "CMakeFiles/oms_core_lib.dir/src/strategies/triangular_detector.cpp.o"
+  "CMakeFiles/oms_core_lib.dir/src/strategies/triangular_detector.cpp.o.d"
+  "liboms_core_lib.a"
+  "liboms_core_lib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oms_core_lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "liboms_core_lib.a"
+)
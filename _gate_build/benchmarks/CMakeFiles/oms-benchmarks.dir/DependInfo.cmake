@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/engine/order_manager.cpp" "benchmarks/CMakeFiles/oms-benchmarks.dir/__/engine/order_manager.cpp.o" "gcc" "benchmarks/CMakeFiles/oms-benchmarks.dir/__/engine/order_manager.cpp.o.d"
+  "/root/repo/core/benchmarks/core_benchmarks.cpp" "benchmarks/CMakeFiles/oms-benchmarks.dir/core_benchmarks.cpp.o" "gcc" "benchmarks/CMakeFiles/oms-benchmarks.dir/core_benchmarks.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/CMakeFiles/oms_core_lib.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../oms-benchmarks"
+  "../oms-benchmarks.pdb"
+  "CMakeFiles/oms-benchmarks.dir/__/engine/order_manager.cpp.o"
+  "CMakeFiles/oms-benchmarks.dir/__/engine/order_manager.cpp.o.d"
+  "CMakeFiles/oms-benchmarks.dir/core_benchmarks.cpp.o"
+  "CMakeFiles/oms-benchmarks.dir/core_benchmarks.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oms-benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,301 @@
+// Microbenchmarks for the C++ hot paths, built behind BUILD_BENCHMARKS.
+// These back up the latency targets in the guide (< 100us order
+// processing, < 50us risk checks) with per-operation numbers instead of
+// the Go-side end-to-end figures.
+//
+//   cmake -S core -B build -DBUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release
+//   ./build/oms-benchmarks
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <thread>
+
+#include "order_manager.h"
+#include "ring_buffer.h"
+#include "risk/risk_engine.h"
+#include "strategies/arbitrage_detector.h"
+#include "strategies/market_maker.h"
+#include "types.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+// Best-effort pinning, same pattern as the engine worker threads: a
+// failed set (fewer cores than requested) is ignored so the suite still
+// runs on small machines, just with less stable numbers.
+void PinCurrentThread(int core) {
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(core, &cpuset);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+#else
+    (void)core;
+#endif
+}
+
+oms::Order MakeOrder(uint64_t id) {
+    oms::Order order;
+    order.id = id;
+    order.client_order_id = "bench";
+    order.exchange = oms::ExchangeType::BINANCE_SPOT;
+    order.symbol = "BTCUSDT";
+    order.symbol_id = oms::SymbolRegistry::Instance().Intern("BTCUSDT");
+    order.side = oms::Side::BUY;
+    order.type = oms::OrderType::LIMIT;
+    order.price = oms::Px::FromDouble(50000.0);
+    order.quantity = oms::Qty::FromDouble(0.1);
+    order.executed_quantity = oms::Qty{};
+    order.status = oms::OrderStatus::NEW;
+    order.time_in_force = oms::TimeInForce::GTC;
+    return order;
+}
+
+// ---------------------------------------------------------------------------
+// RingBuffer
+// ---------------------------------------------------------------------------
+
+void BM_RingBufferPushPop(benchmark::State& state) {
+    PinCurrentThread(0);
+    oms::RingBuffer<uint64_t> ring(4096);
+    uint64_t value = 0;
+    for (auto _ : state) {
+        ring.push(value);
+        uint64_t out = 0;
+        ring.pop(out);
+        benchmark::DoNotOptimize(out);
+        ++value;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RingBufferPushPop);
+
+void BM_RingBufferBatch(benchmark::State& state) {
+    PinCurrentThread(0);
+    const size_t batch = static_cast<size_t>(state.range(0));
+    oms::RingBuffer<uint64_t> ring(4096);
+    std::vector<uint64_t> in(batch, 42), out(batch);
+    for (auto _ : state) {
+        ring.push_batch(in.data(), batch);
+        const size_t popped = ring.pop_batch(out.data(), batch);
+        benchmark::DoNotOptimize(popped);
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_RingBufferBatch)->Arg(16)->Arg(64)->Arg(256);
+
+// Producer on one core, consumer on another, throughput measured from
+// the consumer side. With fewer than two cores the threads timeshare
+// and the numbers mostly reflect scheduling, not the buffer.
+void BM_RingBufferCrossCore(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        PinCurrentThread(0);
+    } else {
+        PinCurrentThread(1);
+    }
+
+    static oms::RingBuffer<uint64_t>* ring = nullptr;
+    if (state.thread_index() == 0) {
+        ring = new oms::RingBuffer<uint64_t>(4096);
+    }
+
+    if (state.thread_index() == 0) {
+        // Consumer (the measured side)
+        for (auto _ : state) {
+            uint64_t out;
+            while (!ring->pop(out)) {
+                // producer not yet caught up
+            }
+            benchmark::DoNotOptimize(out);
+        }
+        state.SetItemsProcessed(state.iterations());
+    } else {
+        // Producer
+        uint64_t value = 0;
+        for (auto _ : state) {
+            while (!ring->push(value)) {
+                // consumer not yet caught up
+            }
+            ++value;
+        }
+    }
+
+    if (state.thread_index() == 0) {
+        delete ring;
+        ring = nullptr;
+    }
+}
+BENCHMARK(BM_RingBufferCrossCore)->Threads(2)->UseRealTime();
+
+// ---------------------------------------------------------------------------
+// RiskEngine
+// ---------------------------------------------------------------------------
+
+void BM_RiskEngineCheckOrder(benchmark::State& state) {
+    PinCurrentThread(0);
+    oms::risk::RiskEngine engine{oms::risk::RiskConfig{}};
+    engine.start();
+    const oms::Order order = MakeOrder(1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(engine.checkOrder(order));
+    }
+    engine.stop();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RiskEngineCheckOrder);
+
+void BM_RiskEngineCheckOrdersBatch(benchmark::State& state) {
+    PinCurrentThread(0);
+    const size_t batch = static_cast<size_t>(state.range(0));
+    oms::risk::RiskEngine engine{oms::risk::RiskConfig{}};
+    engine.start();
+    std::vector<oms::Order> orders;
+    for (size_t i = 0; i < batch; ++i) {
+        orders.push_back(MakeOrder(i + 1));
+    }
+    std::vector<uint8_t> results(batch);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            engine.checkOrders(orders.data(), batch, results.data()));
+    }
+    engine.stop();
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_RiskEngineCheckOrdersBatch)->Arg(16)->Arg(64);
+
+// ---------------------------------------------------------------------------
+// ArbitrageDetector
+// ---------------------------------------------------------------------------
+
+void BM_ArbitrageUpdatePriceFeed(benchmark::State& state) {
+    PinCurrentThread(0);
+    oms::strategies::ArbitrageDetector detector{oms::strategies::ArbitrageConfig{}};
+    double tick = 0.0;
+    for (auto _ : state) {
+        detector.updatePriceFeed("binance", "BTCUSDT", 50000.0 + tick, 1.0,
+                                 50010.0 + tick, 1.0);
+        tick += 0.01;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ArbitrageUpdatePriceFeed);
+
+// Full tick cycle: two exchanges update, then detectOpportunities
+// drains the dirty queue and scans the touched symbol.
+void BM_ArbitrageUpdateAndDetect(benchmark::State& state) {
+    PinCurrentThread(0);
+    oms::strategies::ArbitrageDetector detector{oms::strategies::ArbitrageConfig{}};
+    double tick = 0.0;
+    for (auto _ : state) {
+        detector.updatePriceFeed("binance", "BTCUSDT", 50000.0 + tick, 1.0,
+                                 50010.0 + tick, 1.0);
+        detector.updatePriceFeed("bybit", "BTCUSDT", 50100.0 + tick, 1.0,
+                                 50110.0 + tick, 1.0);
+        detector.detectOpportunities();
+        oms::strategies::ArbitrageOpportunity opp;
+        while (detector.getNextOpportunity(opp)) {
+            benchmark::DoNotOptimize(opp);
+        }
+        tick += 0.01;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ArbitrageUpdateAndDetect);
+
+// ---------------------------------------------------------------------------
+// MarketMakerEngine
+// ---------------------------------------------------------------------------
+
+void BM_MarketMakerUpdateMarketData(benchmark::State& state) {
+    PinCurrentThread(0);
+    oms::strategies::MarketMakerEngine engine{oms::strategies::MarketMakerConfig{}};
+    double tick = 0.0;
+    for (auto _ : state) {
+        engine.updateMarketData("BTCUSDT", 50000.0 + tick, 2.0,
+                                50001.0 + tick, 2.0, 50000.5 + tick);
+        tick += 0.01;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MarketMakerUpdateMarketData);
+
+// Tick-to-quote latency with the quote workers running: push a price
+// move past the requote tolerance, then wait for the first resulting
+// quote delta. Measures the whole feed -> worker -> quote buffer path.
+void BM_MarketMakerTickToQuote(benchmark::State& state) {
+    PinCurrentThread(0);
+    oms::strategies::MarketMakerConfig config;
+    oms::strategies::MarketMakerEngine engine{config};
+    engine.start();
+
+    bool up = false;
+    for (auto _ : state) {
+        // Oscillate the mid by ~20 bps so every tick exceeds the
+        // requote price tolerance and the worker must emit deltas
+        up = !up;
+        const double mid = up ? 50100.0 : 50000.0;
+        engine.updateMarketData("BTCUSDT", mid - 0.5, 2.0, mid + 0.5, 2.0, mid);
+        oms::strategies::MMQuote quote;
+        while (!engine.getNextQuote(quote)) {
+            std::this_thread::yield();
+        }
+        benchmark::DoNotOptimize(quote);
+        // Drain the rest of the tick's deltas outside the hot wait
+        while (engine.getNextQuote(quote)) {
+            benchmark::DoNotOptimize(quote);
+        }
+    }
+
+    engine.stop();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MarketMakerTickToQuote)->UseRealTime();
+
+// ---------------------------------------------------------------------------
+// AggregatedOrderBook
+// ---------------------------------------------------------------------------
+
+void BM_AggregatedBookGetBestExchange(benchmark::State& state) {
+    PinCurrentThread(0);
+    oms::AggregatedOrderBook book;
+
+    // Three exchanges, 20 levels a side, overlapping prices so the
+    // merge actually interleaves
+    const oms::ExchangeType exchanges[] = {
+        oms::ExchangeType::BINANCE_SPOT,
+        oms::ExchangeType::BYBIT_SPOT,
+        oms::ExchangeType::OKX_SPOT,
+    };
+    for (size_t e = 0; e < 3; ++e) {
+        std::vector<oms::AggregatedOrderBook::Level> bids, asks;
+        for (int i = 0; i < 20; ++i) {
+            const oms::Qty size =
+                oms::Qty::FromDouble(1.0 + 0.5 * static_cast<double>(e));
+            bids.push_back({oms::Px::FromDouble(
+                                50000.0 - i - 0.1 * static_cast<double>(e)),
+                            size, exchanges[e], 1});
+            asks.push_back({oms::Px::FromDouble(
+                                50001.0 + i + 0.1 * static_cast<double>(e)),
+                            size, exchanges[e], 1});
+        }
+        book.UpdateBook(exchanges[e], "BTCUSDT", bids, asks);
+    }
+
+    const oms::Qty quantity =
+        oms::Qty::FromDouble(static_cast<double>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            book.GetBestExchange("BTCUSDT", oms::Side::BUY, quantity));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AggregatedBookGetBestExchange)->Arg(1)->Arg(10)->Arg(50);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -1,184 +1,409 @@
 #include "order_manager.h"
+#include "risk/risk_engine.h"
+#include "shm_transport.h"
+#include "tsc_clock.h"
 #include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <sched.h>
 #include <pthread.h>
 
 namespace oms {
 
-OrderManager::OrderManager(const Config& config) 
+OrderManager::OrderManager(const Config& config)
     : config_(config)
-    , last_rate_check_(std::chrono::steady_clock::now()) {
-    
+    , order_pool_(config.max_active_orders, config.backing_policy,
+                  config.cpu_cores.empty()
+                      ? -1
+                      : NumaNodeOfCpu(config.cpu_cores.front()))
+    , order_index_(config.max_active_orders) {
+    // Queues and the slab live on the node of the processing cores, not
+    // wherever the constructing (gateway) thread happens to run
+    const int numa_node = config.cpu_cores.empty()
+        ? -1
+        : NumaNodeOfCpu(config.cpu_cores.front());
+
+    for (auto& limiter : rate_limiters_) {
+        limiter.Configure(static_cast<uint32_t>(config.max_orders_per_second),
+                          static_cast<uint32_t>(config.max_orders_per_minute));
+    }
+
     // Initialize ring buffers for each exchange type
     for (int i = 0; i <= static_cast<int>(ExchangeType::UPBIT); ++i) {
         auto exchange = static_cast<ExchangeType>(i);
-        order_queues_[exchange] = std::make_unique<RingBuffer<Order>>(config.ring_buffer_size);
+
+        QueueMode mode = config.default_queue_mode;
+        auto mode_it = config.queue_modes.find(exchange);
+        if (mode_it != config.queue_modes.end()) {
+            mode = mode_it->second;
+        }
+
+        order_queues_[exchange] = std::make_unique<OrderQueue>(
+            mode, config.ring_buffer_size, config.backing_policy, numa_node);
+    }
+
+    // The worker layout is fixed here, not in Start(): gateway threads
+    // call queue_waiters_.find() concurrently with Start()/Stop(), so
+    // the map must be built once and never mutated again. Each distinct
+    // core in exchange_cores gets a dedicated worker group so queues
+    // keep exactly one consumer (SPSC); exchanges without a mapping
+    // share one group on cpu_cores.
+    std::map<int, std::vector<ExchangeType>> by_core;
+    std::vector<ExchangeType> shared;
+    for (auto& [exchange, queue] : order_queues_) {
+        auto it = config_.exchange_cores.find(exchange);
+        if (it != config_.exchange_cores.end()) {
+            by_core[it->second].push_back(exchange);
+        } else {
+            shared.push_back(exchange);
+        }
+    }
+
+    auto make_group = [this](std::vector<int> cores,
+                             std::vector<ExchangeType> exchanges) {
+        wait_strategies_.push_back(
+            std::make_unique<WaitStrategy>(config_.wait_mode));
+        WaitStrategy* waiter = wait_strategies_.back().get();
+        for (ExchangeType exchange : exchanges) {
+            queue_waiters_[exchange] = waiter;
+        }
+        worker_groups_.push_back({std::move(cores), std::move(exchanges), waiter});
+    };
+
+    for (auto& [core, exchanges] : by_core) {
+        make_group({core}, exchanges);
+    }
+    if (!shared.empty()) {
+        make_group(config_.cpu_cores, shared);
+    }
+
+    // Journal replay must finish before Start() accepts flow, so live
+    // orders survive a core restart without an exchange REST re-sync
+    if (!config.journal_path.empty()) {
+        journal_ = OrderJournal::Open(config.journal_path, config.journal_capacity);
+        if (journal_) {
+            RecoverFromJournal();
+            journal_->Start();
+        }
     }
 }
 
 OrderManager::~OrderManager() {
     Stop();
+    if (journal_) {
+        journal_->Stop();
+    }
 }
 
 bool OrderManager::SubmitOrder(const Order& order) {
-    // Rate limiting check
-    auto now = std::chrono::steady_clock::now();
-    if (now - last_rate_check_ >= std::chrono::seconds(1)) {
-        orders_this_second_.store(0);
-        last_rate_check_ = now;
-    }
-    
-    if (orders_this_second_.fetch_add(1) >= config_.max_orders_per_second) {
+    // Per-exchange rate limiting: a burst on one exchange no longer
+    // throttles the others
+    auto& limiter = rate_limiters_[static_cast<size_t>(order.exchange)];
+    if (!limiter.TryAcquire()) {
         stats_.orders_rejected.fetch_add(1);
         return false;
     }
     
-    // Submit to appropriate exchange queue
+    // Submit to appropriate exchange queue as a POD record so the queue
+    // copy never heap-allocates
     auto& queue = order_queues_[order.exchange];
-    if (!queue->push(order)) {
+    if (!queue->push(ToOrderRecord(order))) {
         stats_.orders_rejected.fetch_add(1);
         return false;
     }
-    
+
+    // Wake the owning worker if it parked on an empty queue
+    auto waiter_it = queue_waiters_.find(order.exchange);
+    if (waiter_it != queue_waiters_.end()) {
+        waiter_it->second->NotifyIfParked();
+    }
+
     return true;
 }
 
+size_t OrderManager::PumpShmOrders(ShmTransport& shm, size_t max_records) {
+    static constexpr size_t kBatch = 64;
+    OrderRecord batch[kBatch];
+    size_t drained = 0;
+
+    while (drained < max_records) {
+        const size_t want = std::min(kBatch, max_records - drained);
+        const size_t count = shm.popOrderBatch(batch, want);
+        if (count == 0) {
+            break;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const OrderRecord& record = batch[i];
+
+            // The exchange byte crosses a process boundary; reject out
+            // of range values instead of indexing past the arrays
+            const auto exchange_idx = static_cast<size_t>(record.exchange);
+            if (exchange_idx >= rate_limiters_.size()) {
+                stats_.orders_rejected.fetch_add(1);
+                continue;
+            }
+
+            if (!rate_limiters_[exchange_idx].TryAcquire()) {
+                stats_.orders_rejected.fetch_add(1);
+                continue;
+            }
+
+            auto queue_it = order_queues_.find(record.exchange);
+            if (queue_it == order_queues_.end() ||
+                !queue_it->second->push(record)) {
+                stats_.orders_rejected.fetch_add(1);
+                continue;
+            }
+
+            auto waiter_it = queue_waiters_.find(record.exchange);
+            if (waiter_it != queue_waiters_.end()) {
+                waiter_it->second->NotifyIfParked();
+            }
+        }
+
+        drained += count;
+    }
+
+    return drained;
+}
+
 bool OrderManager::CancelOrder(OrderId order_id, ExchangeType exchange) {
     Order cancel_order;
     cancel_order.id = order_id;
     cancel_order.exchange = exchange;
     cancel_order.status = OrderStatus::CANCELED;
-    
+
     return SubmitOrder(cancel_order);
 }
 
 bool OrderManager::UpdateOrder(const Order& order) {
-    std::unique_lock lock(orders_mutex_);
-    
-    auto it = orders_.find(order.id);
-    if (it == orders_.end()) {
-        return false;
-    }
-    
-    *it->second = order;
-    return true;
+    // Stored as the wire record: seqlock readers copy raw bytes, so the
+    // pooled content must stay trivially copyable
+    const OrderRecord record = ToOrderRecord(order);
+    return order_index_.UpdateOrder(order.id, order_pool_,
+                                    [&record](OrderRecord& stored) {
+                                        stored = record;
+                                    });
 }
 
-std::shared_ptr<Order> OrderManager::GetOrder(OrderId order_id) const {
-    std::shared_lock lock(orders_mutex_);
-    
-    auto it = orders_.find(order_id);
-    if (it != orders_.end()) {
-        return it->second;
-    }
-    
-    return nullptr;
+bool OrderManager::GetOrder(OrderId order_id, Order& order) const {
+    return order_index_.ReadOrder(order_id, order_pool_, order);
 }
 
 std::vector<Order> OrderManager::GetOrdersByExchange(ExchangeType exchange) const {
-    std::shared_lock lock(orders_mutex_);
-    
-    std::vector<Order> result;
-    auto it = exchange_orders_.find(exchange);
-    if (it != exchange_orders_.end()) {
-        result.reserve(it->second.size());
-        for (OrderId id : it->second) {
-            auto order_it = orders_.find(id);
-            if (order_it != orders_.end()) {
-                result.push_back(*order_it->second);
-            }
-        }
-    }
-    
-    return result;
+    return order_index_.CollectByExchange(exchange, order_pool_);
 }
 
 void OrderManager::Start() {
     if (running_.exchange(true)) {
         return; // Already running
     }
-    
-    processing_thread_ = std::thread([this] {
-        SetCPUAffinity(config_.cpu_cores);
-        ProcessingLoop();
-    });
+
+    // Only spawn threads; the groups and waiter map were fixed at
+    // construction so producers never race a mutating Start()
+    for (const WorkerGroup& group : worker_groups_) {
+        worker_threads_.emplace_back([this, &group] {
+            SetCPUAffinity(group.cores);
+            ProcessingLoop(group.exchanges, group.waiter);
+        });
+    }
 }
 
 void OrderManager::Stop() {
     if (!running_.exchange(false)) {
         return; // Already stopped
     }
-    
-    if (processing_thread_.joinable()) {
-        processing_thread_.join();
+
+    // Unpark any worker sleeping on its futex so it can observe the stop
+    for (auto& waiter : wait_strategies_) {
+        waiter->NotifyIfParked();
     }
+
+    for (auto& thread : worker_threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    worker_threads_.clear();
+    // wait_strategies_ and queue_waiters_ stay intact: gateway threads
+    // may still be inside SubmitOrder consulting the waiter map, and
+    // notifying a parked-free waiter is harmless
 }
 
-void OrderManager::ProcessingLoop() {
-    Order order;
-    
+void OrderManager::ProcessingLoop(const std::vector<ExchangeType>& exchanges,
+                                  WaitStrategy* waiter) {
+    // Drain queues in chunks so each pass pays for the head/tail atomic
+    // traffic once per batch instead of once per order
+    static constexpr size_t kBatchSize = 64;
+    OrderRecord batch[kBatchSize];
+    uint8_t risk_results[kBatchSize];
+
+    std::vector<OrderQueue*> queues;
+    queues.reserve(exchanges.size());
+    for (ExchangeType exchange : exchanges) {
+        queues.push_back(order_queues_[exchange].get());
+    }
+
     while (running_.load()) {
         bool processed = false;
-        
-        // Process orders from all exchange queues
-        for (auto& [exchange, queue] : order_queues_) {
-            if (queue->pop(order)) {
-                auto start = std::chrono::high_resolution_clock::now();
-                
-                ProcessOrder(order);
-                
-                auto end = std::chrono::high_resolution_clock::now();
-                auto latency_us = std::chrono::duration_cast<std::chrono::microseconds>(
-                    end - start).count();
-                
+
+        // Process orders from the queues this worker owns
+        for (OrderQueue* queue : queues) {
+            const size_t count = queue->pop_batch(batch, kBatchSize);
+
+            // Fused risk gate: one batched pass over the drained chunk
+            // while it is still hot in cache. Cancels bypass the gate -
+            // pulling flow off the book must never be blocked by limits.
+            if (risk_engine_ != nullptr && count > 0) {
+                risk_engine_->checkOrders(batch, count, risk_results);
+                for (size_t i = 0; i < count; ++i) {
+                    risk_results[i] |= static_cast<uint8_t>(
+                        batch[i].status == OrderStatus::CANCELED);
+                }
+            } else {
+                std::memset(risk_results, 1, count);
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                if (!risk_results[i]) {
+                    batch[i].status = OrderStatus::REJECTED;
+                    rejection_buffer_.push(batch[i]);
+                    stats_.orders_rejected.fetch_add(1);
+                    continue;
+                }
+
+                const uint64_t start_ns = TscClock::NowNanos();
+
+                ProcessOrder(batch[i]);
+
+                const uint64_t latency_us =
+                    (TscClock::NowNanos() - start_ns) / 1000;
+
                 UpdateLatencyStats(latency_us);
                 stats_.orders_processed.fetch_add(1);
-                processed = true;
             }
+            processed |= (count > 0);
         }
-        
-        // Avoid busy waiting if no orders
-        if (!processed) {
-            std::this_thread::yield();
+
+        if (processed) {
+            waiter->Reset();
+        } else {
+            // The park predicate must include the stop signal: Stop()
+            // notifies each waiter once, and a worker that passes the
+            // empty-queue check after that single wakeup would park
+            // with nobody left to wake it. Both sides use seq_cst
+            // (parked flag there, running_ here), so either Stop sees
+            // the parked flag or the worker sees the stop.
+            waiter->IdleWait([this, &queues] {
+                if (!running_.load()) {
+                    return true;
+                }
+                for (OrderQueue* queue : queues) {
+                    if (!queue->empty()) {
+                        return true;
+                    }
+                }
+                return false;
+            });
         }
     }
 }
 
-void OrderManager::ProcessOrder(const Order& order) {
-    if (order.status == OrderStatus::CANCELED) {
-        ProcessCancellation(order.id, order.exchange);
+void OrderManager::ProcessOrder(const OrderRecord& record) {
+    if (record.status == OrderStatus::CANCELED) {
+        ProcessCancellation(record.id, record.exchange);
         return;
     }
-    
-    // Store order
-    auto order_ptr = std::make_shared<Order>(order);
-    order_ptr->id = next_order_id_.fetch_add(1);
-    order_ptr->created_at = std::chrono::duration_cast<std::chrono::microseconds>(
-        std::chrono::system_clock::now().time_since_epoch());
-    
-    {
-        std::unique_lock lock(orders_mutex_);
-        orders_[order_ptr->id] = order_ptr;
-        exchange_orders_[order.exchange].push_back(order_ptr->id);
+
+    // Grab a slab node instead of make_shared: no per-order heap
+    // allocation, no control block
+    const auto handle = order_pool_.Allocate();
+    if (handle == OrderPool::kInvalidHandle) {
+        stats_.orders_rejected.fetch_add(1);
+        return; // max_active_orders live orders
     }
-    
+
+    // Content is filled before the index insert publishes the id, so
+    // readers never see a half-written order.
+    OrderRecord& stored = order_pool_.Get(handle);
+    stored = record;
+    stored.id = next_order_id_.fetch_add(1);
+    stored.created_at = TscClock::WallMicros();
+
+    if (!order_index_.Insert(stored.id, handle, record.exchange)) {
+        order_pool_.Release(handle);
+        stats_.orders_rejected.fetch_add(1);
+        return;
+    }
+
+    // Journal the accepted order (with its assigned id); one ring push,
+    // the writer thread does the mmap copy
+    if (journal_) {
+        journal_->Append(OrderJournal::Event::ORDER_NEW, stored);
+    }
+
     // TODO: Send to exchange connector via NATS
 }
 
 void OrderManager::ProcessCancellation(OrderId order_id, ExchangeType exchange) {
-    std::unique_lock lock(orders_mutex_);
-    
-    auto it = orders_.find(order_id);
-    if (it != orders_.end() && it->second->exchange == exchange) {
-        it->second->status = OrderStatus::CANCELED;
-        it->second->updated_at = std::chrono::duration_cast<std::chrono::microseconds>(
-            std::chrono::system_clock::now().time_since_epoch());
+    order_index_.UpdateOrder(order_id, order_pool_,
+                             [exchange](OrderRecord& stored) {
+        if (stored.exchange == exchange) {
+            stored.status = OrderStatus::CANCELED;
+            stored.updated_at = TscClock::WallMicros();
+        }
+    });
+
+    if (journal_) {
+        OrderRecord record{};
+        record.id = order_id;
+        record.exchange = exchange;
+        journal_->Append(OrderJournal::Event::ORDER_CANCEL, record);
     }
-    
+
     // TODO: Send cancellation to exchange connector via NATS
 }
 
+void OrderManager::RecoverFromJournal() {
+    OrderId max_id = 0;
+
+    journal_->Replay([this, &max_id](const OrderJournal::Record& record) {
+        switch (record.event) {
+        case OrderJournal::Event::ORDER_NEW: {
+            const auto handle = order_pool_.Allocate();
+            if (handle == OrderPool::kInvalidHandle) {
+                return; // Pool exhausted; remaining records are newer
+            }
+            OrderRecord& stored = order_pool_.Get(handle);
+            stored = record.order;
+            if (!order_index_.Insert(stored.id, handle, record.order.exchange)) {
+                order_pool_.Release(handle);
+                return;
+            }
+            max_id = std::max(max_id, stored.id);
+            break;
+        }
+        case OrderJournal::Event::ORDER_CANCEL:
+            order_index_.UpdateOrder(record.order.id, order_pool_,
+                                     [&record](OrderRecord& stored) {
+                if (stored.exchange == record.order.exchange) {
+                    stored.status = OrderStatus::CANCELED;
+                }
+            });
+            break;
+        }
+    });
+
+    // Ids issued after recovery must not collide with journaled ones
+    if (max_id >= next_order_id_.load()) {
+        next_order_id_.store(max_id + 1);
+    }
+}
+
 void OrderManager::SetCPUAffinity(const std::vector<int>& cores) {
 #ifdef __linux__
     cpu_set_t cpuset;
@@ -195,6 +420,7 @@ void OrderManager::SetCPUAffinity(const std::vector<int>& cores) {
 
 void OrderManager::UpdateLatencyStats(uint64_t latency_us) {
     stats_.total_latency_us.fetch_add(latency_us);
+    stats_.latency_histogram_us.Record(latency_us);
     
     // Update min latency
     uint64_t current_min = stats_.min_latency_us.load();
@@ -209,115 +435,173 @@ void OrderManager::UpdateLatencyStats(uint64_t latency_us) {
 
 // AggregatedOrderBook implementation
 
+void AggregatedOrderBook::MergeSide(std::vector<Level>& merged, ExchangeType exchange,
+                                    std::vector<Level> levels, bool descending) {
+    // Drop this exchange's previous levels, then merge the (small)
+    // sorted delta into the already-sorted remainder
+    merged.erase(std::remove_if(merged.begin(), merged.end(),
+                                [exchange](const Level& level) {
+                                    return level.exchange == exchange;
+                                }),
+                 merged.end());
+
+    auto cmp = [descending](const Level& a, const Level& b) {
+        return descending ? a.price > b.price : a.price < b.price;
+    };
+    std::sort(levels.begin(), levels.end(), cmp);
+
+    const size_t middle = merged.size();
+    merged.insert(merged.end(), levels.begin(), levels.end());
+    std::inplace_merge(merged.begin(), merged.begin() + middle, merged.end(), cmp);
+}
+
+void AggregatedOrderBook::Flatten(const std::vector<Level>& merged, FlatSide& flat) {
+    const size_t depth = std::min(merged.size(), MAX_DEPTH);
+    for (size_t i = 0; i < depth; ++i) {
+        flat.quantity[i] = merged[i].quantity.RawMantissa();
+        flat.price[i] = merged[i].price.RawMantissa();
+        flat.exchange[i] = merged[i].exchange;
+    }
+    flat.depth = depth;
+}
+
+AggregatedOrderBook::SymbolBook* AggregatedOrderBook::FindBook(const Symbol& symbol) const {
+    auto it = books_.find(symbol);
+    return it != books_.end() ? it->second.get() : nullptr;
+}
+
 void AggregatedOrderBook::UpdateBook(ExchangeType exchange, const Symbol& symbol,
                                    const std::vector<Level>& bids,
                                    const std::vector<Level>& asks) {
     std::unique_lock lock(book_mutex_);
-    
-    Book& book = books_[symbol][exchange];
-    book.bids = bids;
-    book.asks = asks;
-    book.last_update = std::chrono::duration_cast<std::chrono::microseconds>(
-        std::chrono::system_clock::now().time_since_epoch());
+
+    auto& book_ptr = books_[symbol];
+    if (!book_ptr) {
+        book_ptr = std::make_unique<SymbolBook>();
+        // Publish the lock-free route to this book's top-of-book.
+        // Books are never erased, so the pointer stays valid for the
+        // lifetime of the aggregated book.
+        const SymbolId sid = SymbolRegistry::Instance().Intern(symbol.c_str());
+        if (sid != kInvalidSymbolId) {
+            books_by_id_[sid].store(book_ptr.get(), std::memory_order_release);
+        }
+    }
+    SymbolBook& book = *book_ptr;
+
+    Book& exchange_book = book.per_exchange[exchange];
+    exchange_book.bids = bids;
+    exchange_book.asks = asks;
+    exchange_book.last_update = TscClock::WallMicros();
+
+    // Merge only this exchange's delta instead of re-sorting everything
+    MergeSide(book.merged.bids, exchange, bids, /*descending=*/true);
+    MergeSide(book.merged.asks, exchange, asks, /*descending=*/false);
+    book.merged.last_update = exchange_book.last_update;
+
+    Flatten(book.merged.bids, book.flat_bids);
+    Flatten(book.merged.asks, book.flat_asks);
+
+    // Republish the cached top-of-book under the seqlock
+    book.top_version.fetch_add(1, std::memory_order_release);
+    book.best_bid = book.merged.bids.empty()
+        ? Level{Px{}, Qty{}, ExchangeType::BINANCE_SPOT, 0}
+        : book.merged.bids.front();
+    book.best_ask = book.merged.asks.empty()
+        ? Level{Px{}, Qty{}, ExchangeType::BINANCE_SPOT, 0}
+        : book.merged.asks.front();
+    book.top_version.fetch_add(1, std::memory_order_release);
 }
 
 AggregatedOrderBook::Book AggregatedOrderBook::GetAggregatedBook(const Symbol& symbol) const {
     std::shared_lock lock(book_mutex_);
-    
-    auto symbol_it = books_.find(symbol);
-    if (symbol_it == books_.end()) {
+
+    const SymbolBook* book = FindBook(symbol);
+    if (!book) {
         return Book{};
     }
-    
-    std::vector<Book> exchange_books;
-    for (const auto& [exchange, book] : symbol_it->second) {
-        exchange_books.push_back(book);
-    }
-    
-    return MergeBooks(exchange_books);
+
+    return book->merged;
 }
 
-std::pair<AggregatedOrderBook::Level, AggregatedOrderBook::Level> 
+std::pair<AggregatedOrderBook::Level, AggregatedOrderBook::Level>
 AggregatedOrderBook::GetBestBidAsk(const Symbol& symbol) const {
-    auto book = GetAggregatedBook(symbol);
-    
-    Level best_bid{0, 0, ExchangeType::BINANCE_SPOT, 0};
-    Level best_ask{std::numeric_limits<Price>::max(), 0, ExchangeType::BINANCE_SPOT, 0};
-    
-    if (!book.bids.empty()) {
-        best_bid = book.bids.front();
+    Level best_bid{Px{}, Qty{}, ExchangeType::BINANCE_SPOT, 0};
+    Level best_ask{Px::Max(), Qty{}, ExchangeType::BINANCE_SPOT, 0};
+
+    // Resolve the book without touching book_mutex_: taking even the
+    // shared lock here would serialize against UpdateBook's unique
+    // lock, leaving the seqlock below with nothing to do and every
+    // read paying the mutex RMW. The registry-indexed pointer is
+    // published once and books are never erased.
+    const SymbolId sid = SymbolRegistry::Instance().Lookup(symbol.c_str());
+    if (sid == kInvalidSymbolId) {
+        return {best_bid, best_ask};
     }
-    
-    if (!book.asks.empty()) {
-        best_ask = book.asks.front();
+    const SymbolBook* book = books_by_id_[sid].load(std::memory_order_acquire);
+    if (!book) {
+        return {best_bid, best_ask};
     }
-    
-    return {best_bid, best_ask};
-}
 
-ExchangeType AggregatedOrderBook::GetBestExchange(const Symbol& symbol, Side side,
-                                                 Quantity quantity) const {
-    auto book = GetAggregatedBook(symbol);
-    
-    if (side == Side::BUY && !book.asks.empty()) {
-        // Find exchange with best ask price and sufficient liquidity
-        Quantity cumulative = 0;
-        for (const auto& level : book.asks) {
-            cumulative += level.quantity;
-            if (cumulative >= quantity) {
-                return level.exchange;
-            }
+    // Seqlock read: retry if an UpdateBook republished mid-copy
+    for (;;) {
+        const uint64_t v1 = book->top_version.load(std::memory_order_acquire);
+        if (v1 & 1) {
+            continue;
         }
-        return book.asks.front().exchange;
-    } else if (side == Side::SELL && !book.bids.empty()) {
-        // Find exchange with best bid price and sufficient liquidity
-        Quantity cumulative = 0;
-        for (const auto& level : book.bids) {
-            cumulative += level.quantity;
-            if (cumulative >= quantity) {
-                return level.exchange;
-            }
+        best_bid = book->best_bid;
+        best_ask = book->best_ask;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (book->top_version.load(std::memory_order_relaxed) == v1) {
+            break;
         }
-        return book.bids.front().exchange;
     }
-    
-    return ExchangeType::BINANCE_SPOT; // Default
+
+    if (best_ask.quantity.IsZero() && best_ask.price.IsZero()) {
+        best_ask.price = Px::Max();
+    }
+
+    return {best_bid, best_ask};
 }
 
-AggregatedOrderBook::Book AggregatedOrderBook::MergeBooks(const std::vector<Book>& books) const {
-    Book merged;
-    
-    // Merge all bids
-    std::vector<Level> all_bids;
-    for (const auto& book : books) {
-        all_bids.insert(all_bids.end(), book.bids.begin(), book.bids.end());
+ExchangeType AggregatedOrderBook::GetBestExchange(const Symbol& symbol, Side side,
+                                                 Qty quantity) const {
+    std::shared_lock lock(book_mutex_);
+
+    const SymbolBook* book = FindBook(symbol);
+    if (!book) {
+        return ExchangeType::BINANCE_SPOT; // Default
     }
-    
-    // Sort bids by price (descending)
-    std::sort(all_bids.begin(), all_bids.end(),
-              [](const Level& a, const Level& b) { return a.price > b.price; });
-    
-    // Merge all asks
-    std::vector<Level> all_asks;
-    for (const auto& book : books) {
-        all_asks.insert(all_asks.end(), book.asks.begin(), book.asks.end());
+
+    const FlatSide& flat =
+        (side == Side::BUY) ? book->flat_asks : book->flat_bids;
+
+    if (flat.depth == 0) {
+        return ExchangeType::BINANCE_SPOT; // Default
     }
-    
-    // Sort asks by price (ascending)
-    std::sort(all_asks.begin(), all_asks.end(),
-              [](const Level& a, const Level& b) { return a.price < b.price; });
-    
-    merged.bids = std::move(all_bids);
-    merged.asks = std::move(all_asks);
-    
-    // Set last update to most recent
-    for (const auto& book : books) {
-        if (book.last_update > merged.last_update) {
-            merged.last_update = book.last_update;
-        }
+
+    // Branch-free liquidity walk over the SoA arrays: a prefix sum of
+    // the quantities followed by a counting compare, both of which the
+    // compiler vectorizes - and with int64 mantissas the lanes are
+    // integer adds and compares, exact to the last dust unit
+    int64_t cumulative[MAX_DEPTH];
+    int64_t running = 0;
+    for (size_t i = 0; i < flat.depth; ++i) {
+        running += flat.quantity[i];
+        cumulative[i] = running;
     }
-    
-    return merged;
+
+    const int64_t wanted = quantity.RawMantissa();
+    size_t fill_depth = 0;
+    for (size_t i = 0; i < flat.depth; ++i) {
+        fill_depth += (cumulative[i] < wanted) ? 1 : 0;
+    }
+
+    if (fill_depth >= flat.depth) {
+        // Not enough total liquidity: route to the best-priced venue
+        return flat.exchange[0];
+    }
+
+    return flat.exchange[fill_depth];
 }
 
 } // namespace oms
\ No newline at end of file
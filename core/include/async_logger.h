@@ -0,0 +1,95 @@
+#ifndef OMS_ASYNC_LOGGER_H
+#define OMS_ASYNC_LOGGER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#include "ring_buffer.h"
+
+namespace oms {
+
+// Everything the logger can say, as an id plus raw operands. The hot
+// thread never formats: it pushes one fixed-size record, and the
+// background thread turns the id into text.
+enum class LogEvent : uint16_t {
+    RISK_ENGINE_STARTED = 0,
+    RISK_ENGINE_STOPPED,
+    RISK_ORDER_VALUE_LIMIT,    // arg0 = order value
+    RISK_POSITION_LIMIT,       // arg0 = would-be position value
+    RISK_DAILY_LOSS_LIMIT,     // arg0 = daily pnl
+    RISK_OPEN_ORDERS_LIMIT,    // arg0 = open orders
+    RISK_SYMBOL_REGISTRY_FULL,
+    RISK_DAILY_PNL_RESET,
+    STATS_RISK,                // arg0 = checks, arg1 = avg latency us
+    STATS_ARBITRAGE,           // arg0 = opportunities, arg1 = prices processed
+    STATS_MARKET_MAKER         // arg0 = quotes, arg1 = market updates
+};
+
+// Fixed-size binary log record; formatting happens off the hot path
+struct LogRecord {
+    LogEvent event;
+    uint16_t reserved;
+    uint32_t thread_slot;
+    uint64_t timestamp_ns;
+    double arg0;
+    double arg1;
+    double arg2;
+};
+
+static_assert(std::is_trivially_copyable_v<LogRecord>,
+              "LogRecord must stay trivially copyable for the ring buffer");
+
+// Asynchronous binary logger. Hot threads push LogRecords into a
+// per-thread SPSC RingBuffer (~one ring push per log call, no
+// allocation, no formatting); a background thread drains all rings,
+// formats the records and writes them out. Records are dropped, never
+// blocked on, when a ring fills.
+class AsyncLogger {
+public:
+    static constexpr size_t MAX_THREADS = 64;
+    static constexpr size_t RING_SIZE = 8192;
+
+    static AsyncLogger& Instance();
+
+    // Hot path: one SPSC ring push
+    void Log(LogEvent event, double arg0 = 0.0, double arg1 = 0.0,
+             double arg2 = 0.0);
+
+    // Background drain thread control. Log() before Start() still
+    // buffers; records are emitted once the drainer runs.
+    void Start();
+    void Stop();
+
+    // Where formatted output goes (stdout by default)
+    void SetOutput(FILE* output) { output_ = output; }
+
+    uint64_t DroppedRecords() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    AsyncLogger() = default;
+    ~AsyncLogger();
+
+    RingBuffer<LogRecord>* ThreadBuffer();
+    void DrainLoop();
+    void DrainOnce();
+    static void FormatRecord(const LogRecord& record, char* buf, size_t len);
+
+    std::array<std::atomic<RingBuffer<LogRecord>*>, MAX_THREADS> buffers_{};
+    std::atomic<size_t> thread_count_{0};
+    std::atomic<uint64_t> dropped_{0};
+
+    std::thread drain_thread_;
+    std::atomic<bool> running_{false};
+    FILE* output_{stdout};
+};
+
+} // namespace oms
+
+#endif // OMS_ASYNC_LOGGER_H
@@ -0,0 +1,181 @@
+#ifndef OMS_BACKING_STORE_H
+#define OMS_BACKING_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#ifdef __linux__
+#include <cstdio>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace oms {
+
+// How large long-lived arrays (ring buffer storage, the order slab)
+// back their memory. A 1M-entry order queue spans hundreds of
+// thousands of 4KB pages and shows up as dTLB misses in the processing
+// loop; 2MB pages collapse that to a handful of TLB entries. On
+// multi-socket boxes the storage should also live on the NUMA node of
+// the pinned consumer instead of whichever node touched it first.
+enum class BackingPolicy : uint8_t {
+    HEAP = 0,       // operator new, first-touch placement (default)
+    HUGE_PAGES = 1  // 2MB MAP_HUGETLB; transparent-hugepage advice as
+                    // fallback; plain heap as last resort
+};
+
+// NUMA node owning a CPU, probed from sysfs so there is no libnuma
+// dependency. Returns -1 when unknown (single-node box, non-Linux).
+inline int NumaNodeOfCpu(int cpu) {
+#ifdef __linux__
+    char path[80];
+    for (int node = 0; node < 256; ++node) {
+        std::snprintf(path, sizeof(path),
+                      "/sys/devices/system/cpu/cpu%d/node%d", cpu, node);
+        if (::access(path, F_OK) == 0) {
+            return node;
+        }
+    }
+#else
+    (void)cpu;
+#endif
+    return -1;
+}
+
+namespace detail {
+
+// Raw allocation with the policy fallback chain. Kept separate from
+// the typed array so the mmap/mbind plumbing stays in one place.
+struct RawBacking {
+    void* base = nullptr;
+    size_t bytes = 0;
+    bool mapped = false;
+
+    static RawBacking Allocate(size_t bytes, BackingPolicy policy,
+                               int numa_node) {
+        RawBacking backing;
+        backing.bytes = bytes;
+
+#ifdef __linux__
+        if (policy == BackingPolicy::HUGE_PAGES && bytes > 0) {
+            // Explicit 2MB pages first (needs reserved hugepages)
+            constexpr size_t kHugeSize = 2 * 1024 * 1024;
+            const size_t rounded = (bytes + kHugeSize - 1) & ~(kHugeSize - 1);
+            void* base = ::mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                                -1, 0);
+            if (base == MAP_FAILED) {
+                // No reserved hugepages: take a normal mapping and ask
+                // the kernel to back it transparently
+                base = ::mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (base != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+                    (void)::madvise(base, rounded, MADV_HUGEPAGE);
+#endif
+                }
+            }
+            if (base != MAP_FAILED) {
+                BindToNode(base, rounded, numa_node);
+                backing.base = base;
+                backing.bytes = rounded;
+                backing.mapped = true;
+                return backing;
+            }
+            // Fall through to the heap
+        }
+#else
+        (void)policy;
+        (void)numa_node;
+#endif
+
+        backing.base = ::operator new(
+            bytes, std::align_val_t{kHeapAlignment});
+        return backing;
+    }
+
+    void Release() {
+        if (base == nullptr) {
+            return;
+        }
+#ifdef __linux__
+        if (mapped) {
+            ::munmap(base, bytes);
+            base = nullptr;
+            return;
+        }
+#endif
+        ::operator delete(base, std::align_val_t{kHeapAlignment});
+        base = nullptr;
+    }
+
+private:
+    // Cache-line alignment for the heap path; mmap is page-aligned
+    static constexpr size_t kHeapAlignment = 64;
+
+#ifdef __linux__
+    // Bind freshly mapped (untouched) pages to one node so the first
+    // touch during construction faults them in the right place.
+    // Best-effort via the raw syscall - no libnuma.
+    static void BindToNode(void* base, size_t bytes, int node) {
+#ifdef SYS_mbind
+        if (node < 0 || node >= 64) {
+            return;
+        }
+        constexpr int kMpolBind = 2;
+        unsigned long nodemask = 1ul << node;
+        (void)::syscall(SYS_mbind, base, bytes, kMpolBind, &nodemask,
+                        sizeof(nodemask) * 8, 0u);
+#else
+        (void)base;
+        (void)bytes;
+        (void)node;
+#endif
+    }
+#endif
+};
+
+} // namespace detail
+
+// Fixed-size array of T on policy-selected backing. Elements are
+// default-constructed up front, which also pre-touches every page (on
+// the bound node) so nothing faults mid-session.
+template <typename T>
+class BackedArray {
+public:
+    BackedArray(size_t count, BackingPolicy policy, int numa_node)
+        : backing_(detail::RawBacking::Allocate(count * sizeof(T), policy,
+                                                numa_node))
+        , count_(count) {
+        T* items = data();
+        for (size_t i = 0; i < count_; ++i) {
+            new (items + i) T();
+        }
+    }
+
+    ~BackedArray() {
+        T* items = data();
+        for (size_t i = count_; i > 0; --i) {
+            items[i - 1].~T();
+        }
+        backing_.Release();
+    }
+
+    BackedArray(const BackedArray&) = delete;
+    BackedArray& operator=(const BackedArray&) = delete;
+
+    T* data() { return static_cast<T*>(backing_.base); }
+    const T* data() const { return static_cast<const T*>(backing_.base); }
+    T& operator[](size_t i) { return data()[i]; }
+    const T& operator[](size_t i) const { return data()[i]; }
+
+private:
+    detail::RawBacking backing_;
+    size_t count_;
+};
+
+} // namespace oms
+
+#endif // OMS_BACKING_STORE_H
@@ -0,0 +1,120 @@
+#ifndef OMS_FIXED_POINT_H
+#define OMS_FIXED_POINT_H
+
+#include <compare>
+#include <cstdint>
+
+namespace oms {
+
+// Fixed-point price/quantity representation: an int64 mantissa at 1e-8
+// resolution (satoshi-grade, fine enough for every listed tick and lot
+// size). Exact integer compares replace the epsilon games doubles force
+// on book sorting, dust-level quantities survive arithmetic unharmed,
+// and the raw mantissas are radix-sortable and friendly to integer
+// vector loops.
+//
+// Px and Qty share the implementation but are distinct types, so a
+// price can never be handed where a quantity is expected. Exchange
+// boundaries still speak double (the wire records and the feed
+// callbacks are unchanged); conversion happens once at the edge.
+inline constexpr int64_t FIXED_POINT_SCALE = 100000000;  // 1e-8
+
+namespace detail {
+
+template <typename Tag>
+class Fixed {
+public:
+    constexpr Fixed() = default;
+
+    static constexpr Fixed FromMantissa(int64_t mantissa) {
+        Fixed result;
+        result.mantissa_ = mantissa;
+        return result;
+    }
+
+    static constexpr Fixed FromDouble(double value) {
+        const double scaled = value * static_cast<double>(FIXED_POINT_SCALE);
+        return FromMantissa(
+            static_cast<int64_t>(scaled + (scaled < 0 ? -0.5 : 0.5)));
+    }
+
+    static constexpr Fixed Max() { return FromMantissa(INT64_MAX); }
+
+    constexpr double ToDouble() const {
+        return static_cast<double>(mantissa_) /
+               static_cast<double>(FIXED_POINT_SCALE);
+    }
+
+    constexpr int64_t RawMantissa() const { return mantissa_; }
+    constexpr bool IsZero() const { return mantissa_ == 0; }
+
+    // Exact compares - the point of the exercise
+    constexpr auto operator<=>(const Fixed&) const = default;
+
+    constexpr Fixed operator+(Fixed other) const {
+        return FromMantissa(mantissa_ + other.mantissa_);
+    }
+    constexpr Fixed operator-(Fixed other) const {
+        return FromMantissa(mantissa_ - other.mantissa_);
+    }
+    constexpr Fixed operator-() const { return FromMantissa(-mantissa_); }
+    constexpr Fixed& operator+=(Fixed other) {
+        mantissa_ += other.mantissa_;
+        return *this;
+    }
+    constexpr Fixed& operator-=(Fixed other) {
+        mantissa_ -= other.mantissa_;
+        return *this;
+    }
+    constexpr Fixed operator*(int64_t scalar) const {
+        return FromMantissa(mantissa_ * scalar);
+    }
+
+    // Snap to an exchange tick/lot grid. step is the grid spacing
+    // (e.g. the symbol's tick size); zero steps pass the value through.
+    constexpr Fixed RoundDownTo(Fixed step) const {
+        if (step.mantissa_ <= 0) {
+            return *this;
+        }
+        int64_t snapped = (mantissa_ / step.mantissa_) * step.mantissa_;
+        if (mantissa_ < 0 && snapped != mantissa_) {
+            snapped -= step.mantissa_;  // floor, not truncate
+        }
+        return FromMantissa(snapped);
+    }
+
+    constexpr Fixed RoundNearestTo(Fixed step) const {
+        if (step.mantissa_ <= 0) {
+            return *this;
+        }
+        const int64_t half = step.mantissa_ / 2;
+        const int64_t shifted = mantissa_ + (mantissa_ < 0 ? -half : half);
+        return FromMantissa((shifted / step.mantissa_) * step.mantissa_);
+    }
+
+private:
+    int64_t mantissa_ = 0;
+};
+
+} // namespace detail
+
+struct PxTag;
+struct QtyTag;
+
+using Px = detail::Fixed<PxTag>;
+using Qty = detail::Fixed<QtyTag>;
+
+// Order value in quote currency. The mantissa product spans up to
+// ~1e18 * 1e18, so it is formed in double; notional feeds risk limits
+// and PnL, where double precision is what the limits are stated in.
+constexpr double Notional(Px price, Qty quantity) {
+    return price.ToDouble() * quantity.ToDouble();
+}
+
+static_assert(Px::FromDouble(50000.0).RawMantissa() == 5000000000000ll);
+static_assert(Px::FromDouble(0.1) + Px::FromDouble(0.2) == Px::FromDouble(0.3));
+static_assert(Qty::FromDouble(0.00000001).RawMantissa() == 1);
+
+} // namespace oms
+
+#endif // OMS_FIXED_POINT_H
@@ -0,0 +1,114 @@
+#ifndef OMS_LATENCY_HISTOGRAM_H
+#define OMS_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace oms {
+
+// Fixed-size log-linear (HDR-style) histogram. Values are bucketed into
+// powers of two, each split into 32 linear sub-buckets, giving ~3%
+// relative error across the whole range. Record is a single relaxed
+// fetch_add (wait-free), so the processing thread can feed it per order;
+// percentile queries walk the counters without perturbing writers.
+//
+// Unit-agnostic: OrderManager records microseconds, RiskEngine records
+// nanoseconds.
+class LatencyHistogram {
+public:
+    static constexpr size_t SUB_BUCKET_BITS = 5;
+    static constexpr size_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;   // 32
+    // Group 0 covers [0, 32); 40 log groups extend the range to 2^44,
+    // several hours even at nanosecond resolution
+    static constexpr size_t LOG_GROUPS = 40;
+    static constexpr size_t NUM_BUCKETS = (LOG_GROUPS + 1) * SUB_BUCKETS;
+
+    // Wait-free: one relaxed fetch_add on the owning bucket
+    void Record(uint64_t value) {
+        buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        total_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Value at or below which fraction p of recordings fall.
+    // p is in [0, 1]; returns the lower bound of the matching bucket.
+    uint64_t GetPercentile(double p) const {
+        const uint64_t total = total_count_.load(std::memory_order_relaxed);
+        if (total == 0) {
+            return 0;
+        }
+
+        uint64_t target = static_cast<uint64_t>(p * static_cast<double>(total));
+        if (target >= total) {
+            target = total - 1;
+        }
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+            seen += buckets_[i].load(std::memory_order_relaxed);
+            if (seen > target) {
+                return BucketLowerBound(i);
+            }
+        }
+        return BucketLowerBound(NUM_BUCKETS - 1);
+    }
+
+    // Snapshot several percentiles in one pass-friendly call,
+    // e.g. GetPercentiles({0.5, 0.99, 0.999})
+    std::vector<uint64_t> GetPercentiles(const std::vector<double>& ps) const {
+        std::vector<uint64_t> result;
+        result.reserve(ps.size());
+        for (double p : ps) {
+            result.push_back(GetPercentile(p));
+        }
+        return result;
+    }
+
+    uint64_t TotalCount() const {
+        return total_count_.load(std::memory_order_relaxed);
+    }
+
+    void Reset() {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        total_count_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static size_t BucketIndex(uint64_t value) {
+        if (value < SUB_BUCKETS) {
+            return static_cast<size_t>(value);
+        }
+
+        const size_t exp = std::bit_width(value) - 1;
+        const size_t group = exp - SUB_BUCKET_BITS + 1;
+        if (group > LOG_GROUPS) {
+            // Clamp out-of-range values into the top bucket
+            return NUM_BUCKETS - 1;
+        }
+
+        // Top SUB_BUCKET_BITS+1 bits select the linear sub-bucket
+        const size_t sub =
+            static_cast<size_t>(value >> (exp - SUB_BUCKET_BITS)) - SUB_BUCKETS;
+        return group * SUB_BUCKETS + sub;
+    }
+
+    static uint64_t BucketLowerBound(size_t index) {
+        const size_t group = index / SUB_BUCKETS;
+        const size_t sub = index % SUB_BUCKETS;
+        if (group == 0) {
+            return sub;
+        }
+        return static_cast<uint64_t>(SUB_BUCKETS + sub) << (group - 1);
+    }
+
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets_{};
+    std::atomic<uint64_t> total_count_{0};
+};
+
+} // namespace oms
+
+#endif // OMS_LATENCY_HISTOGRAM_H
@@ -0,0 +1,116 @@
+#ifndef OMS_MARKET_DATA_CAPTURE_H
+#define OMS_MARKET_DATA_CAPTURE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include "ring_buffer.h"
+
+namespace oms {
+
+// One captured tick: everything either engine entry point received,
+// stamped at capture time. Fixed layout so a capture file is just a
+// header followed by a flat array of these, mmap-able for replay.
+struct CaptureRecord {
+    uint64_t timestamp_ns;
+    double bid_price;
+    double bid_quantity;   // bid size for market maker ticks
+    double ask_price;
+    double ask_quantity;   // ask size for market maker ticks
+    double last_price;     // only meaningful for market maker ticks
+    char exchange[16];     // empty for market maker ticks
+    char symbol[16];
+    uint8_t target;        // CaptureTarget
+    uint8_t reserved[7];
+};
+
+static_assert(std::is_trivially_copyable_v<CaptureRecord>,
+              "capture records are written and mapped as raw bytes");
+
+enum class CaptureTarget : uint8_t {
+    ARBITRAGE = 0,     // ArbitrageDetector::updatePriceFeed
+    MARKET_MAKER = 1   // MarketMakerEngine::updateMarketData
+};
+
+// Capture writer: engines tee each update into a ring (one push on the
+// feed path); a background thread drains it to the capture file. Drops
+// and counts when the ring is full rather than slowing the feed.
+class MarketDataCapture {
+public:
+    static constexpr size_t RING_SIZE = 65536;
+    static constexpr uint32_t MAGIC = 0x50434D4F; // "OMCP"
+    static constexpr uint32_t VERSION = 1;
+
+    // File header preceding the record array
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t record_size;
+        uint8_t reserved[48];
+    };
+
+    static std::unique_ptr<MarketDataCapture> Create(const std::string& path);
+    ~MarketDataCapture();
+
+    MarketDataCapture(const MarketDataCapture&) = delete;
+    MarketDataCapture& operator=(const MarketDataCapture&) = delete;
+
+    // Feed-path tee points
+    void RecordArbitrage(const char* exchange, const char* symbol,
+                         double bid_price, double bid_quantity,
+                         double ask_price, double ask_quantity);
+    void RecordMarketMaker(const char* symbol,
+                           double bid_price, double bid_size,
+                           double ask_price, double ask_size,
+                           double last_price);
+
+    void Start();
+    void Stop();
+
+    uint64_t CapturedRecords() const { return written_.load(std::memory_order_relaxed); }
+    uint64_t DroppedRecords() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    explicit MarketDataCapture(FILE* file);
+
+    void Push(const CaptureRecord& record);
+    void WriterLoop();
+    size_t DrainOnce();
+
+    FILE* file_;
+    MPMCRingBuffer<CaptureRecord> ring_;
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::thread writer_thread_;
+    std::atomic<bool> running_{false};
+};
+
+// Read side: maps a capture file and exposes the record array
+class CaptureReader {
+public:
+    static std::unique_ptr<CaptureReader> Open(const std::string& path);
+    ~CaptureReader();
+
+    CaptureReader(const CaptureReader&) = delete;
+    CaptureReader& operator=(const CaptureReader&) = delete;
+
+    const CaptureRecord* records() const { return records_; }
+    size_t count() const { return count_; }
+
+private:
+    CaptureReader(void* base, size_t size, const CaptureRecord* records, size_t count);
+
+    void* base_;
+    size_t size_;
+    const CaptureRecord* records_;
+    size_t count_;
+};
+
+} // namespace oms
+
+#endif // OMS_MARKET_DATA_CAPTURE_H
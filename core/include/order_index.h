@@ -0,0 +1,233 @@
+#ifndef OMS_ORDER_INDEX_H
+#define OMS_ORDER_INDEX_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "types.h"
+#include "order_pool.h"
+#include "ring_buffer.h"
+
+namespace oms {
+
+// Sharded order index: OrderId -> pool handle, sharded by id so that
+// monitoring threads reading orders never block the processing thread's
+// inserts.
+//
+//  - The table itself is insert-only open addressing. The writer
+//    publishes the handle before the key (release store), so lookups are
+//    plain lock-free probes with no retry loop.
+//  - Order *content* in the pool is guarded by a per-shard seqlock:
+//    readers copy the order and retry if the shard version moved,
+//    writers bump the version to odd/even around the mutation. Writers
+//    additionally serialize on a tiny per-shard spinlock, which is
+//    uncontended as long as one thread owns the shard.
+//  - The per-exchange side index is an append-only {id, exchange} log
+//    per shard with an atomic count, replacing the old exchange_orders_
+//    map.
+class OrderIndex {
+public:
+    static constexpr size_t NUM_EXCHANGES =
+        static_cast<size_t>(ExchangeType::UPBIT) + 1;
+
+    explicit OrderIndex(size_t max_orders, size_t shard_count_hint = 0) {
+        size_t hint = shard_count_hint;
+        if (hint == 0) {
+            hint = std::thread::hardware_concurrency();
+            if (hint == 0) {
+                hint = 4;
+            }
+        }
+        shard_count_ = detail::next_power_of_two(hint);
+        shard_mask_ = shard_count_ - 1;
+
+        // 2x headroom keeps open-addressing probe chains short
+        const size_t per_shard =
+            detail::next_power_of_two((max_orders / shard_count_) * 2 + 1);
+
+        shards_ = std::make_unique<Shard[]>(shard_count_);
+        for (size_t i = 0; i < shard_count_; ++i) {
+            shards_[i].slots = std::make_unique<Slot[]>(per_shard);
+            shards_[i].slot_mask = per_shard - 1;
+            shards_[i].insert_log = std::make_unique<LogEntry[]>(per_shard);
+        }
+    }
+
+    // Insert a new id -> handle mapping. Returns false if the shard's
+    // table is full.
+    bool Insert(OrderId id, OrderPool::Handle handle, ExchangeType exchange) {
+        Shard& shard = ShardFor(id);
+        WriterGuard guard(shard);
+
+        size_t slot = SlotFor(id) & shard.slot_mask;
+        for (size_t probes = 0; probes <= shard.slot_mask; ++probes) {
+            Slot& s = shard.slots[slot];
+            if (s.id.load(std::memory_order_relaxed) == 0) {
+                s.handle = handle;
+                s.id.store(id, std::memory_order_release);
+
+                const size_t log_pos =
+                    shard.log_count.load(std::memory_order_relaxed);
+                shard.insert_log[log_pos] = {id, exchange};
+                shard.log_count.store(log_pos + 1, std::memory_order_release);
+                return true;
+            }
+            slot = (slot + 1) & shard.slot_mask;
+        }
+        return false; // Shard full
+    }
+
+    // Lock-free lookup of the pool handle for an id
+    bool Find(OrderId id, OrderPool::Handle& handle) const {
+        const Shard& shard = ShardFor(id);
+
+        size_t slot = SlotFor(id) & shard.slot_mask;
+        for (size_t probes = 0; probes <= shard.slot_mask; ++probes) {
+            const Slot& s = shard.slots[slot];
+            const OrderId slot_id = s.id.load(std::memory_order_acquire);
+            if (slot_id == id) {
+                handle = s.handle;
+                return true;
+            }
+            if (slot_id == 0) {
+                return false; // Hit an empty slot: not present
+            }
+            slot = (slot + 1) & shard.slot_mask;
+        }
+        return false;
+    }
+
+    // Copy an order's content out of the pool under the shard seqlock.
+    // The pooled record is trivially copyable (enforced in OrderPool),
+    // so a copy torn by a concurrent writer is harmless and simply
+    // retried; conversion to the rich type happens only on a
+    // consistent snapshot.
+    bool ReadOrder(OrderId id, const OrderPool& pool, Order& order) const {
+        const Shard& shard = ShardFor(id);
+
+        OrderPool::Handle handle;
+        if (!Find(id, handle)) {
+            return false;
+        }
+
+        OrderRecord record;
+        for (;;) {
+            const uint64_t v1 = shard.version.load(std::memory_order_acquire);
+            if (v1 & 1) {
+                continue; // Writer in progress
+            }
+            record = pool.Get(handle);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (shard.version.load(std::memory_order_relaxed) == v1) {
+                break;
+            }
+        }
+
+        order = ToOrder(record);
+        return true;
+    }
+
+    // Mutate an order's content in place under the shard seqlock.
+    // fn receives a mutable reference to the pooled OrderRecord.
+    template <typename Fn>
+    bool UpdateOrder(OrderId id, OrderPool& pool, Fn&& fn) {
+        Shard& shard = ShardFor(id);
+
+        OrderPool::Handle handle;
+        if (!Find(id, handle)) {
+            return false;
+        }
+
+        WriterGuard guard(shard);
+        fn(pool.Get(handle));
+        return true;
+    }
+
+    // Collect copies of all orders submitted to an exchange, walking
+    // each shard's append-only insert log
+    std::vector<Order> CollectByExchange(ExchangeType exchange,
+                                         const OrderPool& pool) const {
+        std::vector<Order> result;
+
+        for (size_t i = 0; i < shard_count_; ++i) {
+            const Shard& shard = shards_[i];
+            const size_t count = shard.log_count.load(std::memory_order_acquire);
+
+            for (size_t j = 0; j < count; ++j) {
+                const LogEntry& entry = shard.insert_log[j];
+                if (entry.exchange != exchange) {
+                    continue;
+                }
+                Order order;
+                if (ReadOrder(entry.id, pool, order)) {
+                    result.push_back(std::move(order));
+                }
+            }
+        }
+
+        return result;
+    }
+
+    size_t shard_count() const { return shard_count_; }
+
+private:
+    struct Slot {
+        std::atomic<OrderId> id{0};
+        OrderPool::Handle handle{OrderPool::kInvalidHandle};
+    };
+
+    struct LogEntry {
+        OrderId id;
+        ExchangeType exchange;
+    };
+
+    struct Shard {
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> version{0};
+        std::atomic<bool> write_lock{false};
+
+        std::unique_ptr<Slot[]> slots;
+        size_t slot_mask{0};
+
+        std::unique_ptr<LogEntry[]> insert_log;
+        std::atomic<size_t> log_count{0};
+    };
+
+    // Acquires the shard's write spinlock and holds the seqlock odd for
+    // the duration of the mutation
+    class WriterGuard {
+    public:
+        explicit WriterGuard(Shard& shard) : shard_(shard) {
+            while (shard_.write_lock.exchange(true, std::memory_order_acquire)) {
+                // Spin: writers only collide when shards outnumber workers
+            }
+            shard_.version.fetch_add(1, std::memory_order_release);
+        }
+        ~WriterGuard() {
+            shard_.version.fetch_add(1, std::memory_order_release);
+            shard_.write_lock.store(false, std::memory_order_release);
+        }
+    private:
+        Shard& shard_;
+    };
+
+    Shard& ShardFor(OrderId id) { return shards_[id & shard_mask_]; }
+    const Shard& ShardFor(OrderId id) const { return shards_[id & shard_mask_]; }
+
+    // Fibonacci hash spreads sequential ids across each shard's table
+    static size_t SlotFor(OrderId id) {
+        return static_cast<size_t>(id * 0x9E3779B97F4A7C15ull >> 17);
+    }
+
+    std::unique_ptr<Shard[]> shards_;
+    size_t shard_count_{0};
+    size_t shard_mask_{0};
+};
+
+} // namespace oms
+
+#endif // OMS_ORDER_INDEX_H
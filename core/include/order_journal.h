@@ -0,0 +1,99 @@
+#ifndef OMS_ORDER_JOURNAL_H
+#define OMS_ORDER_JOURNAL_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "ring_buffer.h"
+#include "types.h"
+
+namespace oms {
+
+// Write-ahead journal for working orders: an mmap'd, preallocated file
+// of fixed-size records. Processing threads append by pushing into an
+// in-memory ring (never a syscall, never a block); a dedicated writer
+// thread drains the ring into the mapped region and publishes a
+// monotonic committed sequence. On restart, Replay walks the committed
+// records oldest-first so the order store can be rebuilt before the
+// core accepts flow.
+//
+// The file holds the most recent `capacity` records as a ring keyed by
+// the monotonic sequence, so long-running sessions overwrite history
+// they no longer need while the live working set always survives.
+class OrderJournal {
+public:
+    static constexpr size_t INLET_RING_SIZE = 65536;
+
+    enum class Event : uint8_t {
+        ORDER_NEW = 0,
+        ORDER_CANCEL = 1
+    };
+
+    struct Record {
+        OrderRecord order;
+        Event event;
+        uint8_t reserved[7];
+    };
+
+    static_assert(std::is_trivially_copyable_v<Record>,
+                  "journal records are written with raw memcpy");
+
+    // Opens an existing journal (keeping its contents for replay) or
+    // creates a fresh one. capacity is in records and must be a power
+    // of two. Returns nullptr on failure.
+    static std::unique_ptr<OrderJournal> Open(const std::string& path,
+                                              size_t capacity);
+
+    ~OrderJournal();
+
+    OrderJournal(const OrderJournal&) = delete;
+    OrderJournal& operator=(const OrderJournal&) = delete;
+
+    // Hot path: one ring push. If the inlet ring is momentarily full
+    // the record is dropped and counted rather than blocking the
+    // processing thread.
+    bool Append(Event event, const OrderRecord& order);
+
+    // Writer thread control
+    void Start();
+    void Stop();
+
+    // Replay committed records oldest-first (at most the most recent
+    // `capacity`). Call before Start, single-threaded.
+    void Replay(const std::function<void(const Record&)>& fn) const;
+
+    uint64_t CommittedRecords() const;
+    uint64_t DroppedAppends() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct FileHeader;
+
+    OrderJournal(void* base, size_t size, int fd, size_t capacity);
+
+    void WriterLoop();
+    size_t DrainOnce();
+
+    void* base_;
+    size_t size_;
+    int fd_;
+    size_t capacity_;
+
+    FileHeader* header_;
+    Record* slots_;
+
+    MPMCRingBuffer<Record> inlet_;
+    std::atomic<uint64_t> dropped_{0};
+
+    std::thread writer_thread_;
+    std::atomic<bool> running_{false};
+};
+
+} // namespace oms
+
+#endif // OMS_ORDER_JOURNAL_H
@@ -1,6 +1,7 @@
 #ifndef OMS_ORDER_MANAGER_H
 #define OMS_ORDER_MANAGER_H
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <unordered_map>
@@ -10,16 +11,55 @@
 
 #include "types.h"
 #include "ring_buffer.h"
+#include "order_pool.h"
+#include "order_index.h"
+#include "order_journal.h"
+#include "wait_strategy.h"
+#include "latency_histogram.h"
+#include "symbol_registry.h"
+#include "token_bucket.h"
 
 namespace oms {
 
+namespace risk {
+class RiskEngine;
+}
+
+class ShmTransport;
+
+// Which ring buffer flavor backs an exchange's intake queue
+enum class QueueMode : uint8_t {
+    SPSC = 0,  // single gateway thread submits for this exchange
+    MPMC = 1   // multiple gateway threads call SubmitOrder concurrently
+};
+
 class OrderManager {
 public:
     struct Config {
         size_t ring_buffer_size = 1048576;  // 1MB
-        size_t max_orders_per_second = 100000;
+        size_t max_orders_per_second = 100000;  // per exchange
+        size_t max_orders_per_minute = 0;       // per exchange, 0 = no minute cap
         size_t max_active_orders = 1000000;
         std::vector<int> cpu_cores = {2, 3};  // CPU affinity
+        QueueMode default_queue_mode = QueueMode::SPSC;
+        // Per-exchange overrides of default_queue_mode
+        std::unordered_map<ExchangeType, QueueMode> queue_modes;
+        // Exchange -> dedicated processing core. Each distinct core gets
+        // its own worker thread owning the exchanges mapped to it, so
+        // every queue keeps exactly one consumer. Exchanges left unmapped
+        // share one worker pinned to cpu_cores (the original behavior).
+        std::unordered_map<ExchangeType, int> exchange_cores;
+        // Idle behavior of processing workers when their queues are empty
+        WaitMode wait_mode = WaitMode::SPIN_YIELD;
+        // Write-ahead journal for working orders. Empty path disables
+        // journaling; otherwise the file is replayed at construction to
+        // rebuild the order store before any flow is accepted.
+        std::string journal_path;
+        size_t journal_capacity = 1048576;  // records, power of two
+        // Storage behind the intake queues and the order slab. With
+        // HUGE_PAGES both sit on 2MB pages bound to the NUMA node of
+        // cpu_cores.front(), with graceful fallback (backing_store.h).
+        BackingPolicy backing_policy = BackingPolicy::HEAP;
     };
 
     explicit OrderManager(const Config& config);
@@ -30,14 +70,38 @@ public:
     bool CancelOrder(OrderId order_id, ExchangeType exchange);
     bool UpdateOrder(const Order& order);
     
-    // Order retrieval
-    std::shared_ptr<Order> GetOrder(OrderId order_id) const;
+    // Order retrieval. GetOrder copies the order out of the pool slot;
+    // returns false if the id is unknown.
+    bool GetOrder(OrderId order_id, Order& order) const;
     std::vector<Order> GetOrdersByExchange(ExchangeType exchange) const;
     
     // Processing control
     void Start();
     void Stop();
     bool IsRunning() const { return running_.load(); }
+
+    // Fused pre-trade pipeline: with a risk engine attached, each
+    // drained batch runs through RiskEngine::checkOrders before
+    // storage - one pass over records already hot in cache, no queue
+    // hop between the risk gate and the processing loop. Rejected
+    // orders land in the rejection ring instead of being dropped.
+    // Attach before Start; nullptr disables the gate.
+    void SetRiskEngine(risk::RiskEngine* risk_engine) {
+        risk_engine_ = risk_engine;
+    }
+
+    // Drain risk-rejected orders (any thread)
+    bool GetNextRejection(OrderRecord& record) {
+        return rejection_buffer_.pop(record);
+    }
+
+    // Shared-memory intake bridge: drain connector-written orders from
+    // the region's order queue into the per-exchange queues, where the
+    // processing workers pick them up like any SubmitOrder flow (same
+    // rate limiting, same wakeups). Returns the number of records
+    // drained. The shm order queue is SPSC, so exactly one thread may
+    // pump a given region.
+    size_t PumpShmOrders(ShmTransport& shm, size_t max_records = 256);
     
     // Statistics
     struct Stats {
@@ -46,15 +110,26 @@ public:
         std::atomic<uint64_t> total_latency_us{0};
         std::atomic<uint64_t> min_latency_us{UINT64_MAX};
         std::atomic<uint64_t> max_latency_us{0};
+        LatencyHistogram latency_histogram_us;
     };
     
     const Stats& GetStats() const { return stats_; }
 
+    // Snapshot processing latency percentiles in microseconds,
+    // e.g. GetLatencyPercentiles({0.5, 0.99, 0.999})
+    std::vector<uint64_t> GetLatencyPercentiles(const std::vector<double>& ps) const {
+        return stats_.latency_histogram_us.GetPercentiles(ps);
+    }
+
 private:
-    // Order processing
-    void ProcessingLoop();
-    void ProcessOrder(const Order& order);
+    // Order processing. Each worker drains only the exchanges it owns.
+    void ProcessingLoop(const std::vector<ExchangeType>& exchanges,
+                        WaitStrategy* waiter);
+    void ProcessOrder(const OrderRecord& record);
     void ProcessCancellation(OrderId order_id, ExchangeType exchange);
+
+    // Rebuild the order store from the journal at startup
+    void RecoverFromJournal();
     
     // CPU affinity
     void SetCPUAffinity(const std::vector<int>& cores);
@@ -66,34 +141,100 @@ private:
     Config config_;
     Stats stats_;
     
+    // Queue wrapper dispatching to the configured flavor without
+    // virtual calls on the hot path
+    class OrderQueue {
+    public:
+        OrderQueue(QueueMode mode, size_t capacity, BackingPolicy backing,
+                   int numa_node) : mode_(mode) {
+            if (mode_ == QueueMode::MPMC) {
+                mpmc_ = std::make_unique<MPMCRingBuffer<OrderRecord>>(
+                    capacity, backing, numa_node);
+            } else {
+                spsc_ = std::make_unique<RingBuffer<OrderRecord>>(
+                    capacity, backing, numa_node);
+            }
+        }
+
+        bool push(const OrderRecord& record) {
+            return mode_ == QueueMode::MPMC ? mpmc_->push(record)
+                                            : spsc_->push(record);
+        }
+
+        size_t pop_batch(OrderRecord* items, size_t max_count) {
+            return mode_ == QueueMode::MPMC ? mpmc_->pop_batch(items, max_count)
+                                            : spsc_->pop_batch(items, max_count);
+        }
+
+        bool empty() const {
+            return mode_ == QueueMode::MPMC ? mpmc_->empty() : spsc_->empty();
+        }
+
+    private:
+        QueueMode mode_;
+        std::unique_ptr<RingBuffer<OrderRecord>> spsc_;
+        std::unique_ptr<MPMCRingBuffer<OrderRecord>> mpmc_;
+    };
+
     // Lock-free ring buffers for each exchange
-    std::unordered_map<ExchangeType, std::unique_ptr<RingBuffer<Order>>> order_queues_;
+    std::unordered_map<ExchangeType, std::unique_ptr<OrderQueue>> order_queues_;
     
-    // Order storage with read-write lock for thread safety
-    mutable std::shared_mutex orders_mutex_;
-    std::unordered_map<OrderId, std::shared_ptr<Order>> orders_;
-    
-    // Exchange-specific order indices
-    std::unordered_map<ExchangeType, std::vector<OrderId>> exchange_orders_;
+    // Order storage: preallocated slab sized from max_active_orders,
+    // with a sharded lock-free index (id -> pool handle, plus the
+    // per-exchange side index) so reads never block the processing
+    // thread's inserts
+    OrderPool order_pool_;
+    OrderIndex order_index_;
+
+    // Write-ahead journal (null when journaling is disabled)
+    std::unique_ptr<OrderJournal> journal_;
+
+    // Fused risk gate (null when no engine is attached). Rejections
+    // from any worker land in one MPMC ring for the supervisor to
+    // drain; a full ring drops the record but still counts it.
+    static constexpr size_t REJECTION_BUFFER_SIZE = 4096;
+    risk::RiskEngine* risk_engine_ = nullptr;
+    MPMCRingBuffer<OrderRecord> rejection_buffer_{REJECTION_BUFFER_SIZE};
     
-    // Processing thread
-    std::thread processing_thread_;
+    // Processing threads: one per distinct core in exchange_cores, plus
+    // one shared worker for unmapped exchanges
+    std::vector<std::thread> worker_threads_;
     std::atomic<bool> running_{false};
+
+    // Worker layout, fixed at construction: one group per distinct
+    // core in exchange_cores plus one shared group for the rest.
+    // Start() only spawns a thread per group.
+    struct WorkerGroup {
+        std::vector<int> cores;
+        std::vector<ExchangeType> exchanges;
+        WaitStrategy* waiter;
+    };
+    std::vector<WorkerGroup> worker_groups_;
+
+    // One wait strategy per worker group, with a per-exchange view so
+    // SubmitOrder can wake the worker that owns the queue it pushed to.
+    // Both are built in the constructor and never mutated again:
+    // gateway threads call find() on the map concurrently with
+    // Start()/Stop(), so it must stay immutable for the manager's
+    // lifetime.
+    std::vector<std::unique_ptr<WaitStrategy>> wait_strategies_;
+    std::unordered_map<ExchangeType, WaitStrategy*> queue_waiters_;
     
     // Order ID generation
     std::atomic<OrderId> next_order_id_{1};
     
-    // Rate limiting
-    std::atomic<uint32_t> orders_this_second_{0};
-    std::chrono::steady_clock::time_point last_rate_check_;
+    // Per-exchange rate limiting (token buckets, no clock syscall)
+    std::array<OrderRateLimiter, OrderIndex::NUM_EXCHANGES> rate_limiters_;
 };
 
 // Aggregated order book for multi-exchange view
 class AggregatedOrderBook {
 public:
+    // Fixed-point levels: price compares in the merge are exact
+    // integer compares, no epsilon needed
     struct Level {
-        Price price;
-        Quantity quantity;
+        Px price;
+        Qty quantity;
         ExchangeType exchange;
         int num_orders;
     };
@@ -104,30 +245,77 @@ public:
         Timestamp last_update;
     };
     
-    // Update order book for an exchange
-    void UpdateBook(ExchangeType exchange, const Symbol& symbol, 
-                   const std::vector<Level>& bids, 
+    // Update order book for an exchange. Merges only this exchange's
+    // delta into the maintained aggregated book and republishes the
+    // cached top-of-book.
+    void UpdateBook(ExchangeType exchange, const Symbol& symbol,
+                   const std::vector<Level>& bids,
                    const std::vector<Level>& asks);
-    
-    // Get aggregated book across all exchanges
+
+    // Get aggregated book across all exchanges (copy of the maintained
+    // merge; no sorting on the read path)
     Book GetAggregatedBook(const Symbol& symbol) const;
-    
-    // Get best bid/ask across all exchanges
+
+    // Get best bid/ask across all exchanges. Fully lock-free: the book
+    // is resolved through the symbol registry id (books are never
+    // erased, so the published pointer stays valid) and the cached
+    // top-of-book is read under its seqlock alone - no shared_mutex
+    // RMW on the hot path.
     std::pair<Level, Level> GetBestBidAsk(const Symbol& symbol) const;
-    
+
     // Find best exchange for execution
-    ExchangeType GetBestExchange(const Symbol& symbol, Side side, 
-                                Quantity quantity) const;
+    ExchangeType GetBestExchange(const Symbol& symbol, Side side,
+                                Qty quantity) const;
 
 private:
+    // Aggregated books rarely exceed ~200 levels per side; deeper
+    // liquidity than this never decides routing
+    static constexpr size_t MAX_DEPTH = 256;
+
+    // Structure-of-arrays image of one merged side. Keeping price,
+    // quantity and exchange in separate contiguous arrays lets the
+    // cumulative-liquidity walk in GetBestExchange run as vectorizable
+    // loops instead of striding over 24-byte Level records. Raw int64
+    // mantissas so the prefix sum and compares stay in integer lanes.
+    struct FlatSide {
+        std::array<int64_t, MAX_DEPTH> quantity;
+        std::array<int64_t, MAX_DEPTH> price;
+        std::array<ExchangeType, MAX_DEPTH> exchange;
+        size_t depth{0};
+    };
+
+    // Per-symbol state: raw per-exchange books, the incrementally
+    // maintained merge (plus its flat SoA image for the liquidity
+    // walk), and a seqlock-published top-of-book
+    struct SymbolBook {
+        std::unordered_map<ExchangeType, Book> per_exchange;
+        Book merged;
+        FlatSide flat_bids;
+        FlatSide flat_asks;
+
+        std::atomic<uint64_t> top_version{0};  // seqlock, odd while writing
+        Level best_bid{Px{}, Qty{}, ExchangeType::BINANCE_SPOT, 0};
+        Level best_ask{Px{}, Qty{}, ExchangeType::BINANCE_SPOT, 0};
+    };
+
+    // Replace one exchange's levels inside a sorted merged side
+    static void MergeSide(std::vector<Level>& merged, ExchangeType exchange,
+                          std::vector<Level> levels, bool descending);
+
+    // Rebuild the SoA image of a merged side (truncated to MAX_DEPTH)
+    static void Flatten(const std::vector<Level>& merged, FlatSide& flat);
+
+    // Map lookup for the mutex-protected paths; caller holds book_mutex_
+    SymbolBook* FindBook(const Symbol& symbol) const;
+
+    // book_mutex_ guards the map and the merged/flat content. The
+    // registry-indexed pointer table below is the lock-free route to a
+    // book's seqlocked top-of-book: UpdateBook publishes the pointer
+    // once at creation and books are never erased, so readers need no
+    // lock to resolve it.
     mutable std::shared_mutex book_mutex_;
-    
-    // Symbol -> Exchange -> Book
-    std::unordered_map<Symbol, 
-        std::unordered_map<ExchangeType, Book>> books_;
-    
-    // Helper to merge order books
-    Book MergeBooks(const std::vector<Book>& books) const;
+    std::unordered_map<Symbol, std::unique_ptr<SymbolBook>> books_;
+    std::array<std::atomic<SymbolBook*>, SymbolRegistry::MAX_SYMBOLS> books_by_id_{};
 };
 
 } // namespace oms
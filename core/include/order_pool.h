@@ -0,0 +1,116 @@
+#ifndef OMS_ORDER_POOL_H
+#define OMS_ORDER_POOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "backing_store.h"
+#include "types.h"
+
+namespace oms {
+
+// Preallocated slab of OrderRecord nodes with a lock-free freelist,
+// sized once from Config::max_active_orders. The processing loop
+// allocates and releases nodes without ever touching the global
+// allocator (or its lock), so accepting an order costs no heap traffic
+// and no shared_ptr control block. Handles are 32-bit slab indices.
+//
+// Nodes hold the trivially copyable wire record, not the rich Order:
+// OrderIndex readers copy node content under a seqlock, and a torn
+// copy of a type with std::string members would free heap buffers out
+// from under a concurrent reader. Torn copies of a POD are merely
+// retried.
+class OrderPool {
+public:
+    using Handle = uint32_t;
+    static constexpr Handle kInvalidHandle = UINT32_MAX;
+
+    explicit OrderPool(size_t capacity,
+                       BackingPolicy backing = BackingPolicy::HEAP,
+                       int numa_node = -1)
+        : slab_(capacity, backing, numa_node)
+        , capacity_(capacity) {
+        // Thread the freelist through the slab. This also pre-touches
+        // every page so we never fault mid-session.
+        for (size_t i = 0; i < capacity_; ++i) {
+            slab_[i].next = (i + 1 < capacity_) ? static_cast<Handle>(i + 1)
+                                                : kInvalidHandle;
+        }
+        free_head_.store(Pack(capacity_ > 0 ? 0 : kInvalidHandle, 0),
+                         std::memory_order_relaxed);
+    }
+
+    // Pop a node off the freelist. Returns kInvalidHandle when the slab
+    // is exhausted (i.e., max_active_orders live orders).
+    Handle Allocate() {
+        uint64_t head = free_head_.load(std::memory_order_acquire);
+
+        for (;;) {
+            const Handle idx = UnpackIndex(head);
+            if (idx == kInvalidHandle) {
+                return kInvalidHandle; // Pool exhausted
+            }
+
+            // Tag increments on every pop to avoid ABA on the CAS
+            const uint64_t next = Pack(slab_[idx].next, UnpackTag(head) + 1);
+            if (free_head_.compare_exchange_weak(head, next,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                allocated_.fetch_add(1, std::memory_order_relaxed);
+                return idx;
+            }
+        }
+    }
+
+    void Release(Handle handle) {
+        uint64_t head = free_head_.load(std::memory_order_acquire);
+
+        for (;;) {
+            slab_[handle].next = UnpackIndex(head);
+            const uint64_t next = Pack(handle, UnpackTag(head) + 1);
+            if (free_head_.compare_exchange_weak(head, next,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                allocated_.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    OrderRecord& Get(Handle handle) { return slab_[handle].order; }
+    const OrderRecord& Get(Handle handle) const { return slab_[handle].order; }
+
+    size_t capacity() const { return capacity_; }
+    size_t allocated() const { return allocated_.load(std::memory_order_relaxed); }
+
+private:
+    struct Node {
+        OrderRecord order{};
+        Handle next = kInvalidHandle;
+    };
+
+    static_assert(std::is_trivially_copyable_v<OrderRecord>,
+                  "pooled content is copied under a seqlock; torn copies "
+                  "must be harmless");
+
+    // Freelist head packs {tag, index} into one 64-bit word for the CAS
+    static uint64_t Pack(Handle index, uint32_t tag) {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+    static Handle UnpackIndex(uint64_t head) {
+        return static_cast<Handle>(head & 0xFFFFFFFFu);
+    }
+    static uint32_t UnpackTag(uint64_t head) {
+        return static_cast<uint32_t>(head >> 32);
+    }
+
+    BackedArray<Node> slab_;
+    const size_t capacity_;
+    std::atomic<uint64_t> free_head_{Pack(kInvalidHandle, 0)};
+    std::atomic<size_t> allocated_{0};
+};
+
+} // namespace oms
+
+#endif // OMS_ORDER_POOL_H
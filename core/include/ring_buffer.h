@@ -1,74 +1,150 @@
 #ifndef OMS_RING_BUFFER_H
 #define OMS_RING_BUFFER_H
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <memory>
 #include <new>
 
+#include "backing_store.h"
+
 namespace oms {
 
+namespace detail {
+
+inline size_t next_power_of_two(size_t n) {
+    n--;
+    n |= n >> 1;
+    n |= n >> 2;
+    n |= n >> 4;
+    n |= n >> 8;
+    n |= n >> 16;
+    n |= n >> 32;
+    n++;
+    return n;
+}
+
+} // namespace detail
+
 template <typename T>
 class RingBuffer {
 private:
     static constexpr size_t CACHE_LINE_SIZE = 64;
-    
+
+    // Each side keeps a locally cached copy of the opposing index so the
+    // hot path only touches the other core's cache line when the buffer
+    // looks full (producer) or empty (consumer).
     struct alignas(CACHE_LINE_SIZE) {
         std::atomic<size_t> head{0};
+        size_t cached_tail{0};  // producer-local copy of consumer tail
     } producer_;
-    
+
     struct alignas(CACHE_LINE_SIZE) {
         std::atomic<size_t> tail{0};
+        size_t cached_head{0};  // consumer-local copy of producer head
     } consumer_;
     
-    std::unique_ptr<T[]> buffer_;
+    BackedArray<T> buffer_;
     const size_t capacity_;
     const size_t mask_;
-    
-    static size_t next_power_of_two(size_t n) {
-        n--;
-        n |= n >> 1;
-        n |= n >> 2;
-        n |= n >> 4;
-        n |= n >> 8;
-        n |= n >> 16;
-        n |= n >> 32;
-        n++;
-        return n;
-    }
-    
+
 public:
-    explicit RingBuffer(size_t capacity)
-        : buffer_(std::make_unique<T[]>(next_power_of_two(capacity)))
-        , capacity_(next_power_of_two(capacity))
+    // backing/numa_node select the storage policy (see backing_store.h);
+    // the defaults keep existing call sites on the plain heap.
+    explicit RingBuffer(size_t capacity,
+                        BackingPolicy backing = BackingPolicy::HEAP,
+                        int numa_node = -1)
+        : buffer_(detail::next_power_of_two(capacity), backing, numa_node)
+        , capacity_(detail::next_power_of_two(capacity))
         , mask_(capacity_ - 1) {
     }
     
     bool push(const T& item) {
         const auto current_head = producer_.head.load(std::memory_order_relaxed);
         const auto next_head = (current_head + 1) & mask_;
-        
-        if (next_head == consumer_.tail.load(std::memory_order_acquire)) {
-            return false; // Buffer full
+
+        if (next_head == producer_.cached_tail) {
+            producer_.cached_tail = consumer_.tail.load(std::memory_order_acquire);
+            if (next_head == producer_.cached_tail) {
+                return false; // Buffer full
+            }
         }
-        
+
         buffer_[current_head] = item;
         producer_.head.store(next_head, std::memory_order_release);
         return true;
     }
-    
+
+    // Push up to count items with a single head update.
+    // Returns the number of items actually pushed.
+    size_t push_batch(const T* items, size_t count) {
+        const auto current_head = producer_.head.load(std::memory_order_relaxed);
+
+        size_t free_slots = (producer_.cached_tail - current_head - 1) & mask_;
+        if (free_slots < count) {
+            producer_.cached_tail = consumer_.tail.load(std::memory_order_acquire);
+            free_slots = (producer_.cached_tail - current_head - 1) & mask_;
+        }
+
+        const size_t to_push = std::min(count, free_slots);
+        if (to_push == 0) {
+            return 0;
+        }
+
+        // Copy in up to two contiguous segments (wrap-around)
+        const size_t first = std::min(to_push, capacity_ - current_head);
+        std::copy_n(items, first, &buffer_[current_head]);
+        if (to_push > first) {
+            std::copy_n(items + first, to_push - first, &buffer_[0]);
+        }
+
+        producer_.head.store((current_head + to_push) & mask_, std::memory_order_release);
+        return to_push;
+    }
+
     bool pop(T& item) {
         const auto current_tail = consumer_.tail.load(std::memory_order_relaxed);
-        
-        if (current_tail == producer_.head.load(std::memory_order_acquire)) {
-            return false; // Buffer empty
+
+        if (current_tail == consumer_.cached_head) {
+            consumer_.cached_head = producer_.head.load(std::memory_order_acquire);
+            if (current_tail == consumer_.cached_head) {
+                return false; // Buffer empty
+            }
         }
-        
+
         item = buffer_[current_tail];
         consumer_.tail.store((current_tail + 1) & mask_, std::memory_order_release);
         return true;
     }
+
+    // Pop up to max_count items with a single tail update.
+    // Returns the number of items actually popped.
+    size_t pop_batch(T* items, size_t max_count) {
+        const auto current_tail = consumer_.tail.load(std::memory_order_relaxed);
+
+        size_t available = (consumer_.cached_head - current_tail) & mask_;
+        if (available == 0) {
+            consumer_.cached_head = producer_.head.load(std::memory_order_acquire);
+            available = (consumer_.cached_head - current_tail) & mask_;
+            if (available == 0) {
+                return 0; // Buffer empty
+            }
+        }
+
+        const size_t to_pop = std::min(max_count, available);
+
+        // Copy out up to two contiguous segments (wrap-around)
+        const size_t first = std::min(to_pop, capacity_ - current_tail);
+        std::copy_n(&buffer_[current_tail], first, items);
+        if (to_pop > first) {
+            std::copy_n(&buffer_[0], to_pop - first, items + first);
+        }
+
+        consumer_.tail.store((current_tail + to_pop) & mask_, std::memory_order_release);
+        return to_pop;
+    }
     
     size_t size() const {
         const auto head = producer_.head.load(std::memory_order_acquire);
@@ -86,6 +162,111 @@ public:
     }
 };
 
+// Bounded multi-producer/multi-consumer queue (Vyukov style). Each slot
+// carries a sequence number, so producers claim a slot with a single CAS
+// on the enqueue position and never serialize behind a shared lock.
+// Use this flavor when SubmitOrder is called from multiple gateway
+// threads; RingBuffer stays the cheaper choice for a single producer.
+template <typename T>
+class MPMCRingBuffer {
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_{0};
+
+    BackedArray<Cell> buffer_;
+    const size_t capacity_;
+    const size_t mask_;
+
+public:
+    explicit MPMCRingBuffer(size_t capacity,
+                            BackingPolicy backing = BackingPolicy::HEAP,
+                            int numa_node = -1)
+        : buffer_(detail::next_power_of_two(capacity), backing, numa_node)
+        , capacity_(detail::next_power_of_two(capacity))
+        , mask_(capacity_ - 1) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            buffer_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(const T& item) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            Cell& cell = buffer_[pos & mask_];
+            const size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                       std::memory_order_relaxed)) {
+                    cell.data = item;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Buffer full
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(T& item) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            Cell& cell = buffer_[pos & mask_];
+            const size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                       std::memory_order_relaxed)) {
+                    item = cell.data;
+                    cell.sequence.store(pos + capacity_, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Buffer empty
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Pop up to max_count items. Slots are claimed one CAS at a time since
+    // concurrent consumers may be interleaved with us.
+    size_t pop_batch(T* items, size_t max_count) {
+        size_t popped = 0;
+        while (popped < max_count && pop(items[popped])) {
+            ++popped;
+        }
+        return popped;
+    }
+
+    size_t size() const {
+        const auto head = enqueue_pos_.load(std::memory_order_acquire);
+        const auto tail = dequeue_pos_.load(std::memory_order_acquire);
+        return head - tail;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+};
+
 } // namespace oms
 
 #endif // OMS_RING_BUFFER_H
\ No newline at end of file
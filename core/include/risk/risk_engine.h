@@ -5,7 +5,10 @@
 #include <array>
 #include <chrono>
 #include <string>
+#include <vector>
 #include "types.h"
+#include "latency_histogram.h"
+#include "symbol_registry.h"
 
 namespace oms {
 namespace risk {
@@ -33,15 +36,31 @@ struct RiskConfig {
 // High-performance risk engine
 class RiskEngine {
 public:
-    static constexpr size_t MAX_SYMBOLS = 1000;
+    // Positions are indexed by dense SymbolRegistry id, so two symbols
+    // can never alias the same bucket
+    static constexpr size_t MAX_SYMBOLS = SymbolRegistry::MAX_SYMBOLS;
     
     RiskEngine(const RiskConfig& config);
     ~RiskEngine() = default;
     
     // Order risk check (< 50 microseconds)
     bool checkOrder(const Order& order);
+
+    // Batch risk check: evaluates all limits for count orders in one
+    // pass with hoisted config loads and branchless per-order
+    // predicates. results[i] is 1 if orders[i] passed; returns the
+    // number of passed orders. Latency bookkeeping is amortized over
+    // the batch.
+    size_t checkOrders(const Order* orders, size_t count, uint8_t* results);
+
+    // Same batch check over wire-format records, for callers fused into
+    // a queue drain (OrderManager's pipeline mode): the records are
+    // already hot in cache and never round-trip through the rich type.
+    size_t checkOrders(const OrderRecord* records, size_t count,
+                       uint8_t* results);
     
     // Update position
+    void updatePosition(SymbolId symbol_id, double quantity, double price);
     void updatePosition(const std::string& symbol, double quantity, double price);
     
     // Update open order count
@@ -60,6 +79,9 @@ public:
     // Statistics
     size_t getTotalChecks() const;
     double getAverageLatencyUs() const;
+    // Check latency percentiles in nanoseconds,
+    // e.g. getLatencyPercentilesNs({0.5, 0.99, 0.999})
+    std::vector<uint64_t> getLatencyPercentilesNs(const std::vector<double>& ps) const;
     
 private:
     // Configuration
@@ -77,13 +99,12 @@ private:
     // Statistics
     std::atomic<size_t> total_checks_{0};
     std::atomic<uint64_t> total_latency_ns_{0};
+    LatencyHistogram latency_histogram_ns_;
     
     // Control
     std::atomic<bool> running_{false};
     
     // Helper methods
-    size_t hashSymbol(const std::string& symbol);
-    void log(const std::string& message);
     double calculateRealizedPnL(double old_quantity, double old_price, 
                                double new_quantity, double new_price);
 };
@@ -0,0 +1,61 @@
+#ifndef OMS_SEQLOCK_H
+#define OMS_SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace oms {
+
+// Single-writer seqlock. The writer bumps the version to odd, copies the
+// value in, then bumps it to even; it never waits. Readers copy the value
+// and retry if the version changed underneath them or was odd when they
+// started, so a torn snapshot can never escape. Reads cost a few extra
+// loads instead of a lock, which is the right trade for values written
+// at market-data rates and read by detection/quoting threads.
+//
+// Only one thread may call Store() on a given instance at a time.
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Seqlock requires a trivially copyable payload");
+
+public:
+    Seqlock() = default;
+
+    // Writer side: wait-free, two version stores around a plain copy
+    void Store(const T& value) {
+        const uint32_t v = version_.load(std::memory_order_relaxed);
+        version_.store(v + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        value_ = value;
+        version_.store(v + 2, std::memory_order_release);
+    }
+
+    // Reader side: retry until a copy completes with a stable, even version
+    T Load() const {
+        T out;
+        uint32_t begin = version_.load(std::memory_order_acquire);
+        for (;;) {
+            if ((begin & 1u) == 0) {
+                out = value_;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                const uint32_t end = version_.load(std::memory_order_relaxed);
+                if (end == begin) {
+                    return out;
+                }
+                begin = end;
+            } else {
+                begin = version_.load(std::memory_order_acquire);
+            }
+        }
+    }
+
+private:
+    std::atomic<uint32_t> version_{0};
+    T value_;
+};
+
+} // namespace oms
+
+#endif // OMS_SEQLOCK_H
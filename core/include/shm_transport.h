@@ -0,0 +1,75 @@
+#ifndef OMS_SHM_TRANSPORT_H
+#define OMS_SHM_TRANSPORT_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "shm_transport_abi.h"
+#include "types.h"
+
+namespace oms {
+
+// Zero-copy transport over a file-backed shared-memory region. The Go
+// connectors map the same file (layout in shm_transport_abi.h) and
+// write MarketDataRecord/OrderRecord slots directly; the core pops them
+// with no serialization, socket hop, or broker traversal. NATS remains
+// the fallback path when the region is unavailable, per the design
+// principles.
+//
+// Usage on the core side:
+//
+//   auto shm = ShmTransport::Open("/dev/shm/oms_binance_spot");
+//   if (shm) {
+//       arb_detector.drainShmFeed(*shm);       // market data queue
+//       order_manager.PumpShmOrders(*shm);     // order queue
+//   }
+//
+// Each queue is strictly SPSC: one Go producer, one core consumer, so
+// each queue of a region must be drained from exactly one thread.
+class ShmTransport {
+public:
+    static constexpr size_t DEFAULT_QUEUE_CAPACITY = 65536;
+
+    // Create a fresh region (truncates any existing file) or open one
+    // a connector already created. Both return nullptr on failure so
+    // callers can fall back to NATS.
+    static std::unique_ptr<ShmTransport> Create(const std::string& path,
+                                                size_t market_data_capacity = DEFAULT_QUEUE_CAPACITY,
+                                                size_t order_capacity = DEFAULT_QUEUE_CAPACITY);
+    static std::unique_ptr<ShmTransport> Open(const std::string& path);
+
+    ~ShmTransport();
+
+    ShmTransport(const ShmTransport&) = delete;
+    ShmTransport& operator=(const ShmTransport&) = delete;
+
+    // Market data queue (producer side exists for tests and loopback)
+    bool pushMarketData(const MarketDataRecord& record);
+    bool popMarketData(MarketDataRecord& record);
+    size_t popMarketDataBatch(MarketDataRecord* records, size_t max_records);
+
+    // Order queue
+    bool pushOrder(const OrderRecord& record);
+    bool popOrder(OrderRecord& record);
+    size_t popOrderBatch(OrderRecord* records, size_t max_records);
+
+    size_t marketDataCapacity() const { return header_->market_data.capacity; }
+    size_t orderCapacity() const { return header_->orders.capacity; }
+
+private:
+    ShmTransport(void* base, size_t size, int fd);
+
+    bool push(OmsShmQueue& queue, const void* record);
+    bool pop(OmsShmQueue& queue, void* record);
+    size_t popBatch(OmsShmQueue& queue, void* records, size_t max_records);
+
+    void* base_;
+    size_t size_;
+    int fd_;
+    OmsShmRegionHeader* header_;
+};
+
+} // namespace oms
+
+#endif // OMS_SHM_TRANSPORT_H
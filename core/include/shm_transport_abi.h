@@ -0,0 +1,98 @@
+#ifndef OMS_SHM_TRANSPORT_ABI_H
+#define OMS_SHM_TRANSPORT_ABI_H
+
+/*
+ * C ABI for the shared-memory transport between the Go connectors and
+ * the C++ core. This header is plain C so the Go side can mirror it via
+ * cgo (or re-declare the layouts in Go) and map the region with mmap.
+ *
+ * The region is one file:
+ *
+ *   [OmsShmRegionHeader][market data slots...][order slots...]
+ *
+ * Each queue is a single-producer single-consumer ring of fixed-size
+ * records. Indices are monotonically increasing uint64s; the slot for
+ * index i is (i & (capacity - 1)), so capacities must be powers of two.
+ * The producer writes the slot, then publishes with a release store of
+ * head + 1; the consumer reads head with acquire, copies the slot, then
+ * stores tail + 1. On the Go side sync/atomic Load/Store on the mapped
+ * words give the same ordering.
+ *
+ * The C++ record layouts in types.h (OrderRecord, MarketDataRecord) are
+ * mirrored here field for field; shm_transport.cpp static_asserts that
+ * the sizes and offsets agree, so drift breaks the build rather than
+ * the wire.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OMS_SHM_MAGIC 0x534D4F31u /* "1OMS" little-endian */
+#define OMS_SHM_VERSION 1u
+
+#define OMS_SHM_MAX_SYMBOL_LENGTH 24
+#define OMS_SHM_MAX_CLIENT_ORDER_ID_LENGTH 40
+
+/* Mirrors oms::MarketDataRecord */
+typedef struct OmsShmMarketData {
+    double bid_price;
+    double ask_price;
+    double bid_quantity;
+    double ask_quantity;
+    double last_price;
+    double volume_24h;
+    int64_t timestamp_us;
+    char symbol[OMS_SHM_MAX_SYMBOL_LENGTH];
+    uint8_t exchange;
+    uint8_t _pad[7];
+} OmsShmMarketData;
+
+/* Mirrors oms::OrderRecord */
+typedef struct OmsShmOrder {
+    uint64_t id;
+    char client_order_id[OMS_SHM_MAX_CLIENT_ORDER_ID_LENGTH];
+    char symbol[OMS_SHM_MAX_SYMBOL_LENGTH];
+    uint16_t symbol_id;
+    uint8_t exchange;
+    uint8_t side;
+    uint8_t type;
+    uint8_t status;
+    uint8_t time_in_force;
+    uint8_t _pad[1];
+    double price;
+    double quantity;
+    double executed_quantity;
+    int64_t created_at_us;
+    int64_t updated_at_us;
+} OmsShmOrder;
+
+/* One SPSC ring. head is written only by the producer, tail only by
+ * the consumer; they sit on separate cache lines. */
+typedef struct OmsShmQueue {
+    uint64_t capacity;    /* power of two, set at creation */
+    uint64_t record_size; /* sizeof the slot type, for validation */
+    uint64_t data_offset; /* byte offset of slot 0 from region start */
+    uint8_t _pad0[40];
+    uint64_t head; /* next index the producer will write */
+    uint8_t _pad1[56];
+    uint64_t tail; /* next index the consumer will read */
+    uint8_t _pad2[56];
+} OmsShmQueue;
+
+typedef struct OmsShmRegionHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t total_size;
+    uint8_t _pad[48];
+    OmsShmQueue market_data; /* Go produces, C++ consumes */
+    OmsShmQueue orders;      /* Go produces, C++ consumes */
+} OmsShmRegionHeader;
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* OMS_SHM_TRANSPORT_ABI_H */
@@ -9,8 +9,14 @@
 #include <string>
 #include "types.h"
 #include "ring_buffer.h"
+#include "seqlock.h"
+#include "symbol_registry.h"
 
 namespace oms {
+
+class MarketDataCapture;
+class ShmTransport;
+
 namespace strategies {
 
 // Price feed structure for fast access
@@ -73,6 +79,7 @@ public:
     static constexpr size_t MAX_EXCHANGES = 10;
     static constexpr size_t MAX_SYMBOLS = 100;
     static constexpr size_t OPPORTUNITY_BUFFER_SIZE = 1024;
+    static constexpr size_t DIRTY_QUEUE_SIZE = 256;
     
     ArbitrageDetector(const ArbitrageConfig& config);
     ~ArbitrageDetector();
@@ -84,9 +91,23 @@ public:
     
     // Detect opportunities (called from dedicated thread)
     void detectOpportunities();
+
+    // Shared-memory feed loop: drain connector-written market data from
+    // the region into updatePriceFeed. Returns the number of records
+    // drained. The shm market data queue is SPSC, so exactly one thread
+    // may drain a given region.
+    size_t drainShmFeed(ShmTransport& shm, size_t max_records = 256);
     
     // Get detected opportunities (lock-free)
     bool getNextOpportunity(ArbitrageOpportunity& opportunity);
+
+    // Shared sink for sibling detectors (e.g. TriangularDetector), so
+    // the consumer drains all opportunity flavours from one buffer.
+    // MPMC: the detection thread and each sibling's market-data thread
+    // all produce into it.
+    oms::MPMCRingBuffer<ArbitrageOpportunity>& opportunityBuffer() {
+        return opportunity_buffer_;
+    }
     
     // Start/stop detection
     void start();
@@ -95,37 +116,79 @@ public:
     // Statistics
     uint64_t getDetectedCount() const { return detected_count_.load(); }
     uint64_t getProcessedPrices() const { return processed_prices_.load(); }
-    
+
+    // Optional capture tee: every updatePriceFeed call is also recorded
+    // for offline replay. Set before start; nullptr disables capture.
+    void setCapture(MarketDataCapture* capture) { capture_ = capture; }
+
 private:
     // Price storage (optimized for cache locality)
     struct SymbolPrices {
-        std::array<PriceFeed, MAX_EXCHANGES> feeds;
+        // Each slot is seqlocked so the detection thread can take a
+        // consistent bid/ask snapshot while the feed thread keeps
+        // writing; a torn pair used to surface as a phantom opportunity
+        std::array<Seqlock<PriceFeed>, MAX_EXCHANGES> feeds;
+
+        // Exchange name per slot, written once when the slot is
+        // claimed, so the update path can search without a feed load
+        char exchange_names[MAX_EXCHANGES][16] = {};
+
+        // Structure-of-arrays mirror of the hot fields. Each 80-byte
+        // PriceFeed mixes strings and doubles, so scanning feeds[]
+        // strides across cache lines; the detection scan reads these
+        // contiguous, 32-byte-aligned arrays instead and the compiler
+        // vectorizes the max/min reductions over them.
+        alignas(32) std::array<double, MAX_EXCHANGES> bid{};
+        alignas(32) std::array<double, MAX_EXCHANGES> ask{};
+        alignas(32) std::array<double, MAX_EXCHANGES> bid_qty{};
+        alignas(32) std::array<double, MAX_EXCHANGES> ask_qty{};
+        alignas(32) std::array<uint64_t, MAX_EXCHANGES> timestamp_ns{};
+
         std::atomic<uint8_t> exchange_count{0};
+
+        // Set while the symbol sits in the dirty queue so repeated
+        // ticks enqueue it only once per detection pass
+        std::atomic<bool> dirty{false};
+
         char symbol[16];
-        
+
         SymbolPrices() { symbol[0] = '\0'; }
     };
     
-    // Fast symbol lookup
-    std::unordered_map<std::string, size_t> symbol_index_;
+    // Fast symbol lookup: registry id -> local dense slot, no string
+    // hashing per update
+    std::array<std::atomic<uint16_t>, SymbolRegistry::MAX_SYMBOLS> id_to_local_;
     std::array<SymbolPrices, MAX_SYMBOLS> symbol_prices_;
     std::atomic<size_t> symbol_count_{0};
     
     // Configuration
     ArbitrageConfig config_;
     
-    // Opportunity buffer (lock-free ring buffer)
-    oms::RingBuffer<ArbitrageOpportunity> opportunity_buffer_;
+    // Opportunity buffer. MPMC rather than SPSC: besides the detection
+    // thread, sibling detectors handed opportunityBuffer() push from
+    // their own market-data threads, and an SPSC ring with two
+    // producers corrupts its sequence.
+    oms::MPMCRingBuffer<ArbitrageOpportunity> opportunity_buffer_;
+
+    // Symbols with fresh ticks since the last detection pass; the
+    // detection thread drains this instead of rescanning every
+    // registered symbol, so its work tracks tick rate rather than
+    // subscription count. MPMC because each exchange connector ticks
+    // from its own thread.
+    oms::MPMCRingBuffer<uint16_t> dirty_queue_;
     
     // Statistics
     std::atomic<uint64_t> detected_count_{0};
     std::atomic<uint64_t> processed_prices_{0};
+
+    MarketDataCapture* capture_ = nullptr;
     
     // Control
     std::atomic<bool> running_{false};
     
     // Helper methods
     size_t getOrCreateSymbolIndex(const char* symbol);
+    void scanSymbol(SymbolPrices& sym_prices, uint64_t current_time);
     void checkArbitrageOpportunity(const PriceFeed& buy, const PriceFeed& sell, const char* symbol);
     double calculateFee(const std::string& exchange, double price, bool is_taker);
     uint64_t getCurrentTimeNanos() const;
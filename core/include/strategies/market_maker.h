@@ -4,26 +4,44 @@
 #include <atomic>
 #include <array>
 #include <chrono>
+#include <memory>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 #include <string>
 #include "types.h"
 #include "ring_buffer.h"
+#include "seqlock.h"
+#include "symbol_registry.h"
 
 namespace oms {
+
+class MarketDataCapture;
+
 namespace strategies {
 
+// What downstream should do with a quote level. Unchanged levels are
+// not emitted at all, so exchange traffic tracks how much the quote
+// actually moved instead of the requote cadence.
+enum class QuoteAction : uint8_t {
+    ADD = 0,    // New level: place an order
+    AMEND = 1,  // Level moved past tolerance: cancel/replace
+    CANCEL = 2  // Level withdrawn: cancel the resting order
+};
+
 // Quote represents a single market maker quote
 struct MMQuote {
     char symbol[16];
     char exchange[16];
     Side side;
+    QuoteAction action;
     double price;
     double quantity;
     int level;
     uint64_t timestamp_ns;
     
-    MMQuote() : side(Side::BUY), price(0), quantity(0), level(0), timestamp_ns(0) {
+    MMQuote() : side(Side::BUY), action(QuoteAction::ADD), price(0), quantity(0),
+               level(0), timestamp_ns(0) {
         symbol[0] = '\0';
         exchange[0] = '\0';
     }
@@ -68,25 +86,45 @@ struct MarketMakerConfig {
     double max_inventory;        // Maximum position
     double inventory_skew;       // Skew factor
     double volatility_factor;    // Volatility adjustment factor
+    double volatility_ewma_alpha; // EWMA weight per tick; an alpha of
+                                  // 2/(N+1) roughly matches an N-tick window
     
     // Risk limits
     double max_position_value;
     double stop_loss_percent;
     double max_daily_loss;
+
+    // Requote tolerances: a level is re-emitted only when its price or
+    // size drifts past these; within tolerance the resting order stands
+    double requote_price_tolerance_bps;
+    double requote_size_tolerance;   // Fraction of quote size
+
+    // Quote workers: one shard per listed core, pinned when CPU
+    // affinity is available. Symbols are spread across shards and
+    // periodically rebalanced by observed tick rate.
+    std::vector<int> worker_cores;
+    uint64_t rebalance_interval_ms;
     
     MarketMakerConfig() : base_spread_bps(10), min_spread_bps(5), max_spread_bps(50),
                          quote_size(1.0), quote_levels(3), level_spacing_bps(2),
                          max_inventory(100.0), inventory_skew(0.5), volatility_factor(1.0),
+                         volatility_ewma_alpha(0.002), // ~1000-tick window
                          max_position_value(100000.0), stop_loss_percent(0.02),
-                         max_daily_loss(1000.0) {}
+                         max_daily_loss(1000.0),
+                         requote_price_tolerance_bps(1.0), requote_size_tolerance(0.05),
+                         worker_cores({2, 3}), rebalance_interval_ms(1000) {}
 };
 
-// High-performance market maker engine
+// High-performance multi-symbol market maker engine. Per-symbol state
+// lives in dense slots keyed by the registry symbol id; quote
+// generation runs on a sharded set of core-pinned workers, each with
+// its own SPSC quote buffer. Shard assignment rebalances periodically
+// by observed tick rate so one hot symbol doesn't starve shard-mates.
 class MarketMakerEngine {
 public:
     static constexpr size_t MAX_QUOTES = 20;
     static constexpr size_t QUOTE_BUFFER_SIZE = 1024;
-    static constexpr size_t PRICE_HISTORY_SIZE = 1000;
+    static constexpr size_t MAX_SYMBOLS = 64;
     
     MarketMakerEngine(const MarketMakerConfig& config);
     ~MarketMakerEngine();
@@ -98,52 +136,94 @@ public:
     // Position updates
     void updatePosition(const char* symbol, double position, double avg_price);
     
-    // Quote generation (called from dedicated thread)
-    void generateQuotes();
-    
-    // Get generated quotes (lock-free)
+    // Get generated quotes. The per-shard form keeps each buffer
+    // strictly SPSC; the plain form drains all shards and assumes a
+    // single consumer.
+    bool getNextQuote(size_t shard, MMQuote& quote);
     bool getNextQuote(MMQuote& quote);
+    size_t numShards() const { return quote_buffers_.size(); }
     
-    // Control
+    // Control: start/stop the quote workers
     void start();
     void stop();
     
     // Statistics
     uint64_t getQuotesGenerated() const { return quotes_generated_.load(); }
     uint64_t getMarketUpdates() const { return market_updates_.load(); }
-    
+
+    // Optional capture tee: every updateMarketData call is also
+    // recorded for offline replay. Set before start; nullptr disables.
+    void setCapture(MarketDataCapture* capture) { capture_ = capture; }
+
 private:
+    // Per-symbol state slot
+    struct SymbolState {
+        char symbol[16] = {};
+
+        // Seqlocked so workers read consistent snapshots while the
+        // feed thread writes
+        Seqlock<MarketSnapshot> market;
+        Seqlock<InventorySnapshot> inventory;
+
+        // Incremental volatility state, feed thread only
+        double last_mid = 0.0;
+        double ewma_return_var = 0.0;
+
+        // Bumped on every market update; doubles as the tick counter
+        // the rebalancer reads and the change signal workers poll
+        std::atomic<uint64_t> tick_seq{0};
+        // Last tick the owning worker quoted against
+        std::atomic<uint64_t> quoted_seq{0};
+
+        // Which worker quotes this symbol. Only the owning worker ever
+        // rewrites it: the rebalancer publishes the desired placement
+        // in next_shard, and the owner migrates between quoting passes
+        // (release store) so the new owner's acquire load sees the
+        // final last_quotes/last_valid. Without that handoff two
+        // workers could run generateSymbolQuotes concurrently and
+        // corrupt the ADD/AMEND/CANCEL delta stream.
+        std::atomic<uint16_t> shard{0};
+        std::atomic<uint16_t> next_shard{0};
+
+        // Last emitted quote per (level, side) slot plus a validity
+        // mask, owning worker only; new quotes diff against these so
+        // unchanged levels produce no traffic
+        std::array<MMQuote, MAX_QUOTES> last_quotes{};
+        uint32_t last_valid = 0;
+    };
+
     // Configuration
     MarketMakerConfig config_;
     
-    // Market state (protected by memory ordering, not atomic)
-    MarketSnapshot market_state_;
-    InventorySnapshot inventory_state_;
-    std::atomic<uint64_t> market_version_{0};
-    std::atomic<uint64_t> inventory_version_{0};
+    // Dense symbol slots plus registry-id lookup, mirroring the
+    // ArbitrageDetector layout
+    std::array<std::atomic<uint16_t>, SymbolRegistry::MAX_SYMBOLS> id_to_local_;
+    std::array<SymbolState, MAX_SYMBOLS> symbols_;
+    std::atomic<size_t> symbol_count_{0};
     
-    // Price history for volatility calculation
-    std::array<double, PRICE_HISTORY_SIZE> price_history_;
-    std::atomic<size_t> price_index_{0};
-    
-    // Quote generation
-    oms::RingBuffer<MMQuote> quote_buffer_;
-    std::array<MMQuote, MAX_QUOTES> current_quotes_;
-    std::atomic<size_t> active_quotes_{0};
+    // One SPSC quote buffer per shard
+    std::vector<std::unique_ptr<oms::RingBuffer<MMQuote>>> quote_buffers_;
+    std::vector<std::thread> workers_;
     
     // Statistics
     std::atomic<uint64_t> quotes_generated_{0};
     std::atomic<uint64_t> market_updates_{0};
+
+    MarketDataCapture* capture_ = nullptr;
     
     // Control
     std::atomic<bool> running_{false};
     
     // Internal methods
+    size_t getOrCreateSymbolSlot(const char* symbol);
+    void workerLoop(size_t shard, int cpu_core);
+    void rebalanceShards(uint64_t* last_ticks);
+    void generateSymbolQuotes(SymbolState& state, oms::RingBuffer<MMQuote>& out);
     double calculateSpread(const MarketSnapshot& market, const InventorySnapshot& inventory);
-    double calculateVolatility();
+    double updateVolatility(SymbolState& state, double mid_price);
     double getInventorySkew(double position);
-    void generateQuoteLevel(const char* symbol, Side side, double mid_price, 
-                           double spread, int level);
+    void buildQuote(MMQuote& quote, const char* symbol, Side side, double mid_price,
+                    double spread, int level, double inventory_ratio);
     uint64_t getCurrentTimeNanos() const;
 };
 
@@ -0,0 +1,127 @@
+#ifndef TRIANGULAR_DETECTOR_H
+#define TRIANGULAR_DETECTOR_H
+
+#include <atomic>
+#include <array>
+#include <vector>
+#include <string>
+#include "types.h"
+#include "ring_buffer.h"
+#include "seqlock.h"
+#include "symbol_registry.h"
+#include "strategies/arbitrage_detector.h"
+
+namespace oms {
+namespace strategies {
+
+// Configuration for triangular arbitrage detection
+struct TriangularConfig {
+    double min_profit_rate;      // Minimum profit rate after fees
+    double min_profit_amount;    // Minimum profit in start-currency units
+    double max_position_size;    // Maximum size of the first leg
+    double taker_fee;            // Taker fee per leg
+    uint64_t opportunity_ttl_ns; // Opportunity time-to-live in nanoseconds
+    std::string exchange;        // Exchange all three legs execute on
+
+    TriangularConfig() : min_profit_rate(0.001), min_profit_amount(10.0),
+                        max_position_size(10000.0), taker_fee(0.001),
+                        opportunity_ttl_ns(500000000), exchange("binance") {}
+};
+
+// Single-exchange triangular arbitrage detector. The cycle graph is
+// precomputed from the registered pair universe at startup; each price
+// update then re-evaluates only the cycles containing the updated pair
+// (three seqlock loads and a handful of multiplies per cycle), never a
+// full graph sweep. Updates are expected from the exchange's single
+// market-data thread; evaluation runs inline on that thread.
+class TriangularDetector {
+public:
+    static constexpr size_t MAX_PAIRS = 128;
+    static constexpr size_t MAX_CURRENCIES = 64;
+
+    // Opportunities go into the caller's buffer, so the consumer drains
+    // two-leg and triangular findings from one place. The sink must be
+    // MPMC: the owner's detection thread produces into it too.
+    TriangularDetector(const TriangularConfig& config,
+                       oms::MPMCRingBuffer<ArbitrageOpportunity>& opportunity_buffer);
+
+    // Startup-only pair registration (not thread-safe): describe the
+    // tradable universe, then build the cycle graph once
+    bool addPair(const char* symbol, const char* base, const char* quote);
+    void buildCycles();
+
+    // Update price feed (lock-free); evaluates affected cycles inline
+    void updatePriceFeed(const char* symbol, double bid_price, double bid_quantity,
+                        double ask_price, double ask_quantity);
+
+    // Start/stop detection
+    void start();
+    void stop();
+
+    // Statistics
+    uint64_t getDetectedCount() const { return detected_count_.load(); }
+    uint64_t getEvaluatedCycles() const { return evaluated_cycles_.load(); }
+    size_t getCycleCount() const { return cycles_.size(); }
+
+private:
+    // Top-of-book for one pair, published through a seqlock
+    struct PairQuote {
+        double bid = 0;
+        double ask = 0;
+        double bid_qty = 0;
+        double ask_qty = 0;
+        uint64_t timestamp_ns = 0;
+    };
+
+    struct Pair {
+        char symbol[16] = {};
+        uint8_t base = 0;
+        uint8_t quote = 0;
+        Seqlock<PairQuote> top;
+    };
+
+    // Three pairs forming a currency triangle; evaluated in both
+    // traversal directions on every affected tick
+    struct Cycle {
+        uint16_t pairs[3];
+        uint8_t start_currency;
+    };
+
+    uint8_t internCurrency(const char* code);
+    void evaluateCycle(const Cycle& cycle, uint64_t now);
+    void evaluateDirection(const Cycle& cycle, const PairQuote* quotes,
+                           bool reverse, uint64_t now);
+
+    // Configuration
+    TriangularConfig config_;
+
+    // Pair and currency universe (fixed after buildCycles)
+    std::array<Pair, MAX_PAIRS> pairs_;
+    size_t pair_count_{0};
+    char currency_names_[MAX_CURRENCIES][8] = {};
+    size_t currency_count_{0};
+
+    // Fast symbol lookup: registry id -> pair index
+    std::array<std::atomic<uint16_t>, SymbolRegistry::MAX_SYMBOLS> id_to_pair_;
+
+    // Precomputed cycles and, per pair, the cycles it participates in
+    std::vector<Cycle> cycles_;
+    std::array<std::vector<uint16_t>, MAX_PAIRS> cycles_of_pair_;
+
+    // Shared opportunity sink (MPMC, owned by the two-leg detector)
+    oms::MPMCRingBuffer<ArbitrageOpportunity>& opportunity_buffer_;
+
+    // Statistics
+    std::atomic<uint64_t> detected_count_{0};
+    std::atomic<uint64_t> evaluated_cycles_{0};
+
+    // Control
+    std::atomic<bool> running_{false};
+
+    uint64_t getCurrentTimeNanos() const;
+};
+
+} // namespace strategies
+} // namespace oms
+
+#endif // TRIANGULAR_DETECTOR_H
@@ -0,0 +1,153 @@
+#ifndef OMS_SYMBOL_REGISTRY_H
+#define OMS_SYMBOL_REGISTRY_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+#include "types.h"
+
+namespace oms {
+
+// Process-wide symbol interning. Symbols are registered once at
+// subscription time and receive dense, stable uint16_t ids, so
+// per-event code indexes flat arrays by id instead of hashing strings
+// (and two symbols can never alias the same slot the way the old
+// hash-modulo addressing could).
+//
+// Intern takes a mutex but runs only when a symbol is first seen;
+// Lookup and Name are lock-free and safe from hot paths.
+class SymbolRegistry {
+public:
+    static constexpr size_t MAX_SYMBOLS = 4096;
+
+    static SymbolRegistry& Instance() {
+        static SymbolRegistry registry;
+        return registry;
+    }
+
+    // Register (or find) a symbol and return its dense id.
+    // Returns kInvalidSymbolId once MAX_SYMBOLS is reached.
+    SymbolId Intern(const char* symbol) {
+        const SymbolId existing = Lookup(symbol);
+        if (existing != kInvalidSymbolId) {
+            return existing;
+        }
+
+        std::lock_guard<std::mutex> lock(intern_mutex_);
+
+        // Re-check under the lock: another thread may have won the race
+        const SymbolId raced = Lookup(symbol);
+        if (raced != kInvalidSymbolId) {
+            return raced;
+        }
+
+        const size_t count = count_.load(std::memory_order_relaxed);
+        if (count >= MAX_SYMBOLS) {
+            return kInvalidSymbolId;
+        }
+
+        const SymbolId id = static_cast<SymbolId>(count);
+        std::strncpy(names_[id], symbol, MAX_SYMBOL_LENGTH - 1);
+        names_[id][MAX_SYMBOL_LENGTH - 1] = '\0';
+
+        // Publish in the probe table: name first, then the slot state
+        size_t slot = Hash(symbol) & TABLE_MASK;
+        for (;;) {
+            if (table_[slot].state.load(std::memory_order_acquire) == 0) {
+                std::strncpy(table_[slot].name, names_[id], MAX_SYMBOL_LENGTH);
+                table_[slot].state.store(static_cast<uint32_t>(id) + 1,
+                                         std::memory_order_release);
+                break;
+            }
+            slot = (slot + 1) & TABLE_MASK;
+        }
+
+        count_.store(count + 1, std::memory_order_release);
+        return id;
+    }
+
+    // Lock-free lookup; kInvalidSymbolId if the symbol was never interned
+    SymbolId Lookup(const char* symbol) const {
+        size_t slot = Hash(symbol) & TABLE_MASK;
+        for (size_t probes = 0; probes <= TABLE_MASK; ++probes) {
+            const uint32_t state = table_[slot].state.load(std::memory_order_acquire);
+            if (state == 0) {
+                return kInvalidSymbolId;
+            }
+            if (std::strcmp(table_[slot].name, symbol) == 0) {
+                return static_cast<SymbolId>(state - 1);
+            }
+            slot = (slot + 1) & TABLE_MASK;
+        }
+        return kInvalidSymbolId;
+    }
+
+    // Reverse lookup; "" for an id that was never assigned
+    const char* Name(SymbolId id) const {
+        if (id >= count_.load(std::memory_order_acquire)) {
+            return "";
+        }
+        return names_[id];
+    }
+
+    size_t size() const { return count_.load(std::memory_order_acquire); }
+
+    // Per-symbol price tick and quantity lot, registered at
+    // subscription time alongside the symbol itself and read lock-free
+    // from hot paths. Symbols without a registered grid default to the
+    // finest representable step (one 1e-8 mantissa unit).
+    void SetTickLot(SymbolId id, Px tick, Qty lot) {
+        if (id >= MAX_SYMBOLS) {
+            return;
+        }
+        ticks_[id].store(tick.RawMantissa(), std::memory_order_relaxed);
+        lots_[id].store(lot.RawMantissa(), std::memory_order_relaxed);
+    }
+
+    Px Tick(SymbolId id) const {
+        const int64_t mantissa =
+            id < MAX_SYMBOLS ? ticks_[id].load(std::memory_order_relaxed) : 0;
+        return Px::FromMantissa(mantissa > 0 ? mantissa : 1);
+    }
+
+    Qty Lot(SymbolId id) const {
+        const int64_t mantissa =
+            id < MAX_SYMBOLS ? lots_[id].load(std::memory_order_relaxed) : 0;
+        return Qty::FromMantissa(mantissa > 0 ? mantissa : 1);
+    }
+
+private:
+    SymbolRegistry() = default;
+
+    // 2x table size keeps probe chains short at full capacity
+    static constexpr size_t TABLE_SIZE = MAX_SYMBOLS * 2;
+    static constexpr size_t TABLE_MASK = TABLE_SIZE - 1;
+
+    struct TableEntry {
+        std::atomic<uint32_t> state{0};  // 0 = empty, else id + 1
+        char name[MAX_SYMBOL_LENGTH]{};
+    };
+
+    static size_t Hash(const char* symbol) {
+        // FNV-1a over the symbol bytes
+        size_t hash = 14695981039346656037ull;
+        for (const char* p = symbol; *p; ++p) {
+            hash ^= static_cast<unsigned char>(*p);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    TableEntry table_[TABLE_SIZE];
+    char names_[MAX_SYMBOLS][MAX_SYMBOL_LENGTH]{};
+    std::atomic<int64_t> ticks_[MAX_SYMBOLS]{};
+    std::atomic<int64_t> lots_[MAX_SYMBOLS]{};
+    std::atomic<size_t> count_{0};
+    std::mutex intern_mutex_;
+};
+
+} // namespace oms
+
+#endif // OMS_SYMBOL_REGISTRY_H
@@ -0,0 +1,126 @@
+#ifndef OMS_TOKEN_BUCKET_H
+#define OMS_TOKEN_BUCKET_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "tsc_clock.h"
+
+namespace oms {
+
+// Lock-free token bucket refilled lazily from the TSC clock: the whole
+// state ({last refill in ms, available tokens}) lives in one 64-bit
+// word, so an acquire is a couple of atomic ops with no clock syscall.
+// Burst capacity equals the window budget.
+class TokenBucket {
+public:
+    TokenBucket() = default;
+
+    // budget tokens per window_ms milliseconds; budget 0 disables the
+    // bucket (always grants)
+    void Configure(uint32_t budget, uint32_t window_ms) {
+        budget_ = budget;
+        window_ms_ = window_ms;
+        state_.store(Pack(NowMs(), budget), std::memory_order_relaxed);
+    }
+
+    bool TryAcquire() {
+        if (budget_ == 0) {
+            return true;
+        }
+
+        const uint32_t now_ms = NowMs();
+        uint64_t cur = state_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            uint32_t last_ms = static_cast<uint32_t>(cur >> 32);
+            uint32_t tokens = static_cast<uint32_t>(cur);
+
+            // Lazy refill: advance last_ms only by the time the added
+            // tokens account for, so fractional refill isn't lost
+            const uint32_t elapsed_ms = now_ms - last_ms; // unsigned wrap is fine
+            const uint64_t add =
+                static_cast<uint64_t>(elapsed_ms) * budget_ / window_ms_;
+            if (add > 0) {
+                if (tokens + add >= budget_) {
+                    tokens = budget_;
+                    last_ms = now_ms;
+                } else {
+                    tokens += static_cast<uint32_t>(add);
+                    last_ms += static_cast<uint32_t>(add * window_ms_ / budget_);
+                }
+            }
+
+            if (tokens == 0) {
+                return false;
+            }
+
+            if (state_.compare_exchange_weak(cur, Pack(last_ms, tokens - 1),
+                                             std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    // Hand a token back (used when a second bucket rejects after this
+    // one already granted)
+    void Return() {
+        if (budget_ == 0) {
+            return;
+        }
+        uint64_t cur = state_.load(std::memory_order_relaxed);
+        for (;;) {
+            const uint32_t last_ms = static_cast<uint32_t>(cur >> 32);
+            uint32_t tokens = static_cast<uint32_t>(cur);
+            if (tokens >= budget_) {
+                return;
+            }
+            if (state_.compare_exchange_weak(cur, Pack(last_ms, tokens + 1),
+                                             std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+private:
+    static uint64_t Pack(uint32_t last_ms, uint32_t tokens) {
+        return (static_cast<uint64_t>(last_ms) << 32) | tokens;
+    }
+
+    static uint32_t NowMs() {
+        return static_cast<uint32_t>(TscClock::NowNanos() / 1000000);
+    }
+
+    uint32_t budget_{0};
+    uint32_t window_ms_{1000};
+    std::atomic<uint64_t> state_{0};
+};
+
+// Per-second plus per-minute budgets for one exchange, matching the
+// limits modeled by RiskLimits::max_orders_per_second/max_orders_per_minute
+class OrderRateLimiter {
+public:
+    void Configure(uint32_t per_second, uint32_t per_minute) {
+        second_bucket_.Configure(per_second, 1000);
+        minute_bucket_.Configure(per_minute, 60000);
+    }
+
+    bool TryAcquire() {
+        if (!second_bucket_.TryAcquire()) {
+            return false;
+        }
+        if (!minute_bucket_.TryAcquire()) {
+            second_bucket_.Return();
+            return false;
+        }
+        return true;
+    }
+
+private:
+    TokenBucket second_bucket_;
+    TokenBucket minute_bucket_;
+};
+
+} // namespace oms
+
+#endif // OMS_TOKEN_BUCKET_H
@@ -0,0 +1,111 @@
+#ifndef OMS_TSC_CLOCK_H
+#define OMS_TSC_CLOCK_H
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#define OMS_HAS_RDTSC 1
+#endif
+
+#include "types.h"
+
+namespace oms {
+
+// Nanosecond clock backed by the TSC. rdtsc is calibrated once against
+// CLOCK_MONOTONIC at first use (~10ms spin), after which a timestamp
+// costs one rdtsc plus a multiply instead of a vDSO/chrono call - the
+// hot paths read the clock four-plus times per order flow event, so
+// this matters. A wall-clock anchor captured at calibration serves
+// epoch timestamps (created_at/updated_at) from the same rdtsc read.
+//
+// On non-x86 builds every call falls back to std::chrono.
+class TscClock {
+public:
+    // Monotonic nanoseconds (same epoch as CLOCK_MONOTONIC)
+    static uint64_t NowNanos() {
+#ifdef OMS_HAS_RDTSC
+        const Calibration& cal = GetCalibration();
+        const uint64_t ticks = __rdtsc() - cal.base_tsc;
+        return cal.base_mono_ns +
+               static_cast<uint64_t>(static_cast<double>(ticks) * cal.ns_per_tick);
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // Microseconds since the Unix epoch, for order timestamps
+    static Timestamp WallMicros() {
+#ifdef OMS_HAS_RDTSC
+        const Calibration& cal = GetCalibration();
+        const uint64_t ticks = __rdtsc() - cal.base_tsc;
+        const uint64_t elapsed_us = static_cast<uint64_t>(
+            static_cast<double>(ticks) * cal.ns_per_tick / 1000.0);
+        return Timestamp(cal.base_wall_us + elapsed_us);
+#else
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+#endif
+    }
+
+    // Force calibration eagerly (e.g. during startup) instead of on the
+    // first hot-path call
+    static void Calibrate() {
+#ifdef OMS_HAS_RDTSC
+        (void)GetCalibration();
+#endif
+    }
+
+private:
+#ifdef OMS_HAS_RDTSC
+    struct Calibration {
+        uint64_t base_tsc;
+        uint64_t base_mono_ns;
+        uint64_t base_wall_us;
+        double ns_per_tick;
+    };
+
+    static const Calibration& GetCalibration() {
+        static const Calibration cal = Calibrate_();
+        return cal;
+    }
+
+    static Calibration Calibrate_() {
+        using clock = std::chrono::steady_clock;
+
+        Calibration cal{};
+        cal.base_wall_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+
+        const auto mono_start = clock::now();
+        const uint64_t tsc_start = __rdtsc();
+
+        // ~10ms window is enough to pin the tick rate to <0.1% error
+        const auto window = std::chrono::milliseconds(10);
+        while (clock::now() - mono_start < window) {
+            // spin
+        }
+
+        const uint64_t tsc_end = __rdtsc();
+        const auto mono_end = clock::now();
+
+        const auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            mono_end - mono_start).count();
+
+        cal.base_tsc = tsc_start;
+        cal.base_mono_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                mono_start.time_since_epoch()).count());
+        cal.ns_per_tick = static_cast<double>(elapsed_ns) /
+                          static_cast<double>(tsc_end - tsc_start);
+        return cal;
+    }
+#endif
+};
+
+} // namespace oms
+
+#endif // OMS_TSC_CLOCK_H
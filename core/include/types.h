@@ -2,15 +2,25 @@
 #define OMS_TYPES_H
 
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <chrono>
+#include <type_traits>
+
+#include "fixed_point.h"
 
 namespace oms {
 
 using OrderId = uint64_t;
+using SymbolId = uint16_t;  // dense id assigned by SymbolRegistry
+constexpr SymbolId kInvalidSymbolId = UINT16_MAX;
 using ClientOrderId = std::string;
 using Symbol = std::string;
 using Exchange = std::string;
+// Wire-format prices/quantities: the queue/shm/journal records and the
+// exchange feed callbacks still speak double. In-memory state (Order,
+// MarketData, the aggregated book) uses the fixed-point Px/Qty from
+// fixed_point.h; conversion happens once at the record boundary.
 using Price = double;
 using Quantity = double;
 using Timestamp = std::chrono::microseconds;
@@ -55,22 +65,106 @@ enum class ExchangeType : uint8_t {
     UPBIT = 6
 };
 
+// Stable lowercase name per exchange, for paths that key state by
+// exchange string (strategy price feeds, fee tables)
+inline const char* ExchangeTypeName(ExchangeType exchange) {
+    switch (exchange) {
+        case ExchangeType::BINANCE_SPOT:    return "binance";
+        case ExchangeType::BINANCE_FUTURES: return "binance_futures";
+        case ExchangeType::BYBIT_SPOT:      return "bybit";
+        case ExchangeType::BYBIT_FUTURES:   return "bybit_futures";
+        case ExchangeType::OKX_SPOT:        return "okx";
+        case ExchangeType::OKX_FUTURES:     return "okx_futures";
+        case ExchangeType::UPBIT:           return "upbit";
+    }
+    return "unknown";
+}
+
 struct Order {
     OrderId id;
     ClientOrderId client_order_id;
     ExchangeType exchange;
     Symbol symbol;
+    SymbolId symbol_id = kInvalidSymbolId;
+    Side side;
+    OrderType type;
+    Px price;
+    Qty quantity;
+    Qty executed_quantity;
+    OrderStatus status;
+    TimeInForce time_in_force;
+    Timestamp created_at;
+    Timestamp updated_at;
+};
+
+// Fixed-size string limits for the wire-format order below
+constexpr size_t MAX_SYMBOL_LENGTH = 24;
+constexpr size_t MAX_CLIENT_ORDER_ID_LENGTH = 40;
+
+// Trivially copyable order used for queue transport. Order above embeds
+// std::string members that heap-allocate on every ring buffer copy, so
+// everything that transits a queue uses this fixed layout instead and
+// converts to the rich type only at the storage boundary.
+struct OrderRecord {
+    OrderId id;
+    char client_order_id[MAX_CLIENT_ORDER_ID_LENGTH];
+    char symbol[MAX_SYMBOL_LENGTH];
+    SymbolId symbol_id;
+    ExchangeType exchange;
     Side side;
     OrderType type;
+    OrderStatus status;
+    TimeInForce time_in_force;
     Price price;
     Quantity quantity;
     Quantity executed_quantity;
-    OrderStatus status;
-    TimeInForce time_in_force;
     Timestamp created_at;
     Timestamp updated_at;
 };
 
+static_assert(std::is_trivially_copyable_v<OrderRecord>,
+              "OrderRecord must stay trivially copyable for queue transport");
+
+inline OrderRecord ToOrderRecord(const Order& order) {
+    OrderRecord record{};
+    record.id = order.id;
+    std::strncpy(record.client_order_id, order.client_order_id.c_str(),
+                 sizeof(record.client_order_id) - 1);
+    std::strncpy(record.symbol, order.symbol.c_str(),
+                 sizeof(record.symbol) - 1);
+    record.symbol_id = order.symbol_id;
+    record.exchange = order.exchange;
+    record.side = order.side;
+    record.type = order.type;
+    record.status = order.status;
+    record.time_in_force = order.time_in_force;
+    record.price = order.price.ToDouble();
+    record.quantity = order.quantity.ToDouble();
+    record.executed_quantity = order.executed_quantity.ToDouble();
+    record.created_at = order.created_at;
+    record.updated_at = order.updated_at;
+    return record;
+}
+
+inline Order ToOrder(const OrderRecord& record) {
+    Order order;
+    order.id = record.id;
+    order.client_order_id = record.client_order_id;
+    order.exchange = record.exchange;
+    order.symbol = record.symbol;
+    order.symbol_id = record.symbol_id;
+    order.side = record.side;
+    order.type = record.type;
+    order.price = Px::FromDouble(record.price);
+    order.quantity = Qty::FromDouble(record.quantity);
+    order.executed_quantity = Qty::FromDouble(record.executed_quantity);
+    order.status = record.status;
+    order.time_in_force = record.time_in_force;
+    order.created_at = record.created_at;
+    order.updated_at = record.updated_at;
+    return order;
+}
+
 struct Position {
     ExchangeType exchange;
     Symbol symbol;
@@ -88,6 +182,20 @@ struct Position {
 struct MarketData {
     ExchangeType exchange;
     Symbol symbol;
+    Px bid_price;
+    Px ask_price;
+    Qty bid_quantity;
+    Qty ask_quantity;
+    Px last_price;
+    Qty volume_24h;
+    Timestamp timestamp;
+};
+
+// Trivially copyable market data used for queue and shared-memory
+// transport, mirroring OrderRecord above. Doubles lead so the layout
+// has no interior padding surprises for the C ABI mirror in
+// shm_transport_abi.h.
+struct MarketDataRecord {
     Price bid_price;
     Price ask_price;
     Quantity bid_quantity;
@@ -95,8 +203,41 @@ struct MarketData {
     Price last_price;
     Quantity volume_24h;
     Timestamp timestamp;
+    char symbol[MAX_SYMBOL_LENGTH];
+    ExchangeType exchange;
 };
 
+static_assert(std::is_trivially_copyable_v<MarketDataRecord>,
+              "MarketDataRecord must stay trivially copyable for queue transport");
+
+inline MarketDataRecord ToMarketDataRecord(const MarketData& data) {
+    MarketDataRecord record{};
+    record.bid_price = data.bid_price.ToDouble();
+    record.ask_price = data.ask_price.ToDouble();
+    record.bid_quantity = data.bid_quantity.ToDouble();
+    record.ask_quantity = data.ask_quantity.ToDouble();
+    record.last_price = data.last_price.ToDouble();
+    record.volume_24h = data.volume_24h.ToDouble();
+    record.timestamp = data.timestamp;
+    std::strncpy(record.symbol, data.symbol.c_str(), sizeof(record.symbol) - 1);
+    record.exchange = data.exchange;
+    return record;
+}
+
+inline MarketData ToMarketData(const MarketDataRecord& record) {
+    MarketData data;
+    data.exchange = record.exchange;
+    data.symbol = record.symbol;
+    data.bid_price = Px::FromDouble(record.bid_price);
+    data.ask_price = Px::FromDouble(record.ask_price);
+    data.bid_quantity = Qty::FromDouble(record.bid_quantity);
+    data.ask_quantity = Qty::FromDouble(record.ask_quantity);
+    data.last_price = Px::FromDouble(record.last_price);
+    data.volume_24h = Qty::FromDouble(record.volume_24h);
+    data.timestamp = record.timestamp;
+    return data;
+}
+
 struct RiskLimits {
     double max_position_size_usd;
     double max_leverage;
@@ -0,0 +1,119 @@
+#ifndef OMS_WAIT_STRATEGY_H
+#define OMS_WAIT_STRATEGY_H
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace oms {
+
+// How a processing worker behaves when its queues are empty
+enum class WaitMode : uint8_t {
+    BUSY_SPIN = 0,   // pure spin with cpu pause: lowest wakeup jitter,
+                     // burns the pinned core (latency-critical boxes)
+    SPIN_YIELD = 1,  // spin briefly, then yield to the scheduler
+    SPIN_PARK = 2    // spin, yield, then park on a futex until a
+                     // producer signals (dense shared boxes)
+};
+
+// Per-worker wait strategy. The consumer calls IdleWait after an empty
+// pass and Reset once work shows up again; producers call NotifyIfParked
+// after a push. The parked flag is only raised once the consumer has
+// seen all its queues empty, so producers end up signaling the futex
+// only on empty -> non-empty transitions and pay a single relaxed load
+// otherwise.
+class WaitStrategy {
+public:
+    explicit WaitStrategy(WaitMode mode) : mode_(mode) {}
+
+    // Consumer side: wait a little harder each time nothing is found.
+    // has_work is re-checked after raising the parked flag so a push
+    // racing with the park can never be missed. It must also cover any
+    // shutdown signal the consumer's loop polls: a stopping thread
+    // typically notifies each waiter once, and a worker parking after
+    // that wakeup has nobody left to wake it.
+    template <typename HasWork>
+    void IdleWait(HasWork&& has_work) {
+        ++idle_count_;
+
+        if (mode_ == WaitMode::BUSY_SPIN || idle_count_ < kSpinLimit) {
+            CpuPause();
+            return;
+        }
+
+        if (mode_ == WaitMode::SPIN_YIELD || idle_count_ < kYieldLimit) {
+            std::this_thread::yield();
+            return;
+        }
+
+        // SPIN_PARK: publish the parked flag, re-check, then sleep
+        parked_.store(1, std::memory_order_seq_cst);
+        if (has_work()) {
+            parked_.store(0, std::memory_order_relaxed);
+            return;
+        }
+        FutexWait();
+        parked_.store(0, std::memory_order_relaxed);
+    }
+
+    // Consumer side: work was found, restart the spin ladder
+    void Reset() {
+        idle_count_ = 0;
+    }
+
+    // Producer side: wake the consumer if (and only if) it is parked
+    void NotifyIfParked() {
+        if (parked_.load(std::memory_order_seq_cst) != 0 &&
+            parked_.exchange(0, std::memory_order_seq_cst) != 0) {
+            FutexWake();
+        }
+    }
+
+    WaitMode mode() const { return mode_; }
+
+private:
+    static constexpr uint32_t kSpinLimit = 4096;
+    static constexpr uint32_t kYieldLimit = 4096 + 64;
+
+    static void CpuPause() {
+#if defined(__x86_64__) || defined(_M_X64)
+        _mm_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    void FutexWait() {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&parked_),
+                FUTEX_WAIT_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    void FutexWake() {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&parked_),
+                FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#endif
+    }
+
+    WaitMode mode_;
+    uint32_t idle_count_ = 0;           // consumer-local
+    std::atomic<uint32_t> parked_{0};   // futex word, 1 while parked
+};
+
+} // namespace oms
+
+#endif // OMS_WAIT_STRATEGY_H
@@ -0,0 +1,168 @@
+#include "async_logger.h"
+
+#include <chrono>
+#include <cstdio>
+
+#include "tsc_clock.h"
+
+namespace oms {
+
+AsyncLogger& AsyncLogger::Instance() {
+    static AsyncLogger logger;
+    return logger;
+}
+
+AsyncLogger::~AsyncLogger() {
+    Stop();
+    for (auto& slot : buffers_) {
+        delete slot.load(std::memory_order_acquire);
+    }
+}
+
+RingBuffer<LogRecord>* AsyncLogger::ThreadBuffer() {
+    thread_local RingBuffer<LogRecord>* buffer = [this]() -> RingBuffer<LogRecord>* {
+        const size_t slot = thread_count_.fetch_add(1, std::memory_order_acq_rel);
+        if (slot >= MAX_THREADS) {
+            return nullptr; // Too many logging threads: drop this one's records
+        }
+        auto* ring = new RingBuffer<LogRecord>(RING_SIZE);
+        buffers_[slot].store(ring, std::memory_order_release);
+        return ring;
+    }();
+    return buffer;
+}
+
+void AsyncLogger::Log(LogEvent event, double arg0, double arg1, double arg2) {
+    RingBuffer<LogRecord>* buffer = ThreadBuffer();
+    if (buffer == nullptr) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    LogRecord record;
+    record.event = event;
+    record.reserved = 0;
+    record.thread_slot = 0;
+    record.timestamp_ns = TscClock::NowNanos();
+    record.arg0 = arg0;
+    record.arg1 = arg1;
+    record.arg2 = arg2;
+
+    if (!buffer->push(record)) {
+        // Never block or allocate on the hot path: drop and count
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void AsyncLogger::Start() {
+    if (running_.exchange(true)) {
+        return; // Already running
+    }
+
+    drain_thread_ = std::thread([this] { DrainLoop(); });
+}
+
+void AsyncLogger::Stop() {
+    if (!running_.exchange(false)) {
+        return; // Already stopped
+    }
+
+    if (drain_thread_.joinable()) {
+        drain_thread_.join();
+    }
+
+    // Flush whatever the hot threads pushed after the last drain pass
+    DrainOnce();
+}
+
+void AsyncLogger::DrainLoop() {
+    while (running_.load(std::memory_order_acquire)) {
+        DrainOnce();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void AsyncLogger::DrainOnce() {
+    const size_t count =
+        std::min(thread_count_.load(std::memory_order_acquire), MAX_THREADS);
+
+    LogRecord record;
+    char line[256];
+
+    for (size_t i = 0; i < count; ++i) {
+        RingBuffer<LogRecord>* buffer = buffers_[i].load(std::memory_order_acquire);
+        if (buffer == nullptr) {
+            continue;
+        }
+
+        while (buffer->pop(record)) {
+            FormatRecord(record, line, sizeof(line));
+            std::fprintf(output_, "%s\n", line);
+        }
+    }
+
+    std::fflush(output_);
+}
+
+void AsyncLogger::FormatRecord(const LogRecord& record, char* buf, size_t len) {
+    const double ts_s = static_cast<double>(record.timestamp_ns) / 1e9;
+
+    switch (record.event) {
+    case LogEvent::RISK_ENGINE_STARTED:
+        std::snprintf(buf, len, "[%.6f] [RiskEngine] started", ts_s);
+        break;
+    case LogEvent::RISK_ENGINE_STOPPED:
+        std::snprintf(buf, len, "[%.6f] [RiskEngine] stopped", ts_s);
+        break;
+    case LogEvent::RISK_ORDER_VALUE_LIMIT:
+        std::snprintf(buf, len,
+                      "[%.6f] [RiskEngine] Order value exceeds limit: %.2f",
+                      ts_s, record.arg0);
+        break;
+    case LogEvent::RISK_POSITION_LIMIT:
+        std::snprintf(buf, len,
+                      "[%.6f] [RiskEngine] Position value would exceed limit: %.2f",
+                      ts_s, record.arg0);
+        break;
+    case LogEvent::RISK_DAILY_LOSS_LIMIT:
+        std::snprintf(buf, len,
+                      "[%.6f] [RiskEngine] Daily loss limit exceeded: %.2f",
+                      ts_s, record.arg0);
+        break;
+    case LogEvent::RISK_OPEN_ORDERS_LIMIT:
+        std::snprintf(buf, len,
+                      "[%.6f] [RiskEngine] Open orders limit exceeded: %.0f",
+                      ts_s, record.arg0);
+        break;
+    case LogEvent::RISK_SYMBOL_REGISTRY_FULL:
+        std::snprintf(buf, len,
+                      "[%.6f] [RiskEngine] Symbol registry full, order rejected",
+                      ts_s);
+        break;
+    case LogEvent::RISK_DAILY_PNL_RESET:
+        std::snprintf(buf, len, "[%.6f] [RiskEngine] Daily PnL reset", ts_s);
+        break;
+    case LogEvent::STATS_RISK:
+        std::snprintf(buf, len,
+                      "[%.6f] [Stats] Risk checks: %.0f (avg latency: %.2f us)",
+                      ts_s, record.arg0, record.arg1);
+        break;
+    case LogEvent::STATS_ARBITRAGE:
+        std::snprintf(buf, len,
+                      "[%.6f] [Stats] Arbitrage opportunities: %.0f (processed: %.0f)",
+                      ts_s, record.arg0, record.arg1);
+        break;
+    case LogEvent::STATS_MARKET_MAKER:
+        std::snprintf(buf, len,
+                      "[%.6f] [Stats] Market maker quotes: %.0f (updates: %.0f)",
+                      ts_s, record.arg0, record.arg1);
+        break;
+    default:
+        std::snprintf(buf, len, "[%.6f] [Unknown event %u] %.2f %.2f %.2f",
+                      ts_s, static_cast<unsigned>(record.event),
+                      record.arg0, record.arg1, record.arg2);
+        break;
+    }
+}
+
+} // namespace oms
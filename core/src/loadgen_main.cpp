@@ -0,0 +1,280 @@
+// oms-loadgen: drives OrderManager::SubmitOrder at high rate from N
+// pinned producer threads for timed soak runs, then reports throughput
+// and the engine's own processing latency percentiles. This is how the
+// 100k orders/sec and <100us targets get checked before a release
+// instead of in production.
+//
+// Usage: oms-loadgen [--threads N] [--duration SEC] [--rate PER_SEC]
+//                    [--symbols K] [--cancel-ratio R] [--burst B]
+//
+//   --threads       producer threads (default 2), pinned to cores 4+
+//   --duration      soak length in seconds (default 10)
+//   --rate          total submit rate, 0 = unthrottled (default 100000)
+//   --symbols       distinct symbols, top-heavy 2:1 distribution (default 8)
+//   --cancel-ratio  fraction of submissions that are cancels (default 0.1)
+//   --burst         orders sent back-to-back per pacing step (default 32)
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "order_manager.h"
+#include "risk/risk_engine.h"
+#include "tsc_clock.h"
+#include "types.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+struct LoadgenConfig {
+    size_t threads = 2;
+    uint64_t duration_s = 10;
+    uint64_t rate = 100000;       // total orders/sec, 0 = max
+    size_t symbols = 8;
+    double cancel_ratio = 0.1;
+    size_t burst = 32;
+};
+
+// Best-effort pinning, same pattern as the engine workers. Producers
+// go on cores 4+ to stay off the processing cores (2,3 by default).
+void PinCurrentThread(int core) {
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(core, &cpuset);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+#else
+    (void)core;
+#endif
+}
+
+// Cheap per-thread RNG so random draws don't dominate the submit cost
+struct Xorshift64 {
+    uint64_t state;
+    explicit Xorshift64(uint64_t seed) : state(seed | 1) {}
+    uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+const char* kSymbols[] = {
+    "BTCUSDT", "ETHUSDT", "BNBUSDT", "SOLUSDT",
+    "XRPUSDT", "ADAUSDT", "DOGEUSDT", "DOTUSDT",
+    "AVAXUSDT", "LINKUSDT", "MATICUSDT", "LTCUSDT",
+    "ATOMUSDT", "UNIUSDT", "NEARUSDT", "APTUSDT",
+};
+constexpr size_t kMaxSymbols = sizeof(kSymbols) / sizeof(kSymbols[0]);
+
+struct ProducerStats {
+    uint64_t submitted = 0;
+    uint64_t cancels = 0;
+    uint64_t rejected = 0;
+};
+
+void ProducerLoop(oms::OrderManager& manager, const LoadgenConfig& config,
+                  size_t thread_idx, std::atomic<bool>& running,
+                  std::atomic<uint64_t>& id_high_water, ProducerStats& stats) {
+    PinCurrentThread(static_cast<int>(4 + thread_idx));
+
+    Xorshift64 rng(0x9E3779B97F4A7C15ull * (thread_idx + 1));
+    const uint64_t per_thread_rate = config.rate / config.threads;
+    const uint64_t burst_interval_ns =
+        per_thread_rate > 0 ? config.burst * 1000000000ull / per_thread_rate : 0;
+    const uint64_t cancel_threshold =
+        static_cast<uint64_t>(config.cancel_ratio * 4294967296.0);
+
+    oms::Order order;
+    order.client_order_id = "loadgen";
+    order.exchange = oms::ExchangeType::BINANCE_SPOT;
+    order.type = oms::OrderType::LIMIT;
+    order.status = oms::OrderStatus::NEW;
+    order.time_in_force = oms::TimeInForce::GTC;
+    order.executed_quantity = oms::Qty{};
+
+    uint64_t next_due_ns = oms::TscClock::NowNanos();
+    while (running.load(std::memory_order_relaxed)) {
+        for (size_t i = 0; i < config.burst; ++i) {
+            const uint64_t r = rng.next();
+
+            if ((r & 0xFFFFFFFFull) < cancel_threshold) {
+                // Cancel a recent id. Ids are assigned sequentially by
+                // the processing thread, so a draw under the high-water
+                // mark usually hits a live or recently live order.
+                const uint64_t high = id_high_water.load(std::memory_order_relaxed);
+                const uint64_t target = high > 0 ? 1 + (r >> 32) % high : 1;
+                if (!manager.CancelOrder(target, oms::ExchangeType::BINANCE_SPOT)) {
+                    ++stats.rejected;
+                }
+                ++stats.cancels;
+                continue;
+            }
+
+            // Top-heavy symbol pick: symbol i gets ~2x the flow of i+1,
+            // like real per-symbol volume distributions
+            size_t sym = static_cast<size_t>(__builtin_ctzll(r | (1ull << 62)));
+            if (sym >= config.symbols) {
+                sym = 0;
+            }
+            order.symbol = kSymbols[sym % kMaxSymbols];
+            order.side = (r & 0x100) ? oms::Side::BUY : oms::Side::SELL;
+            order.price = oms::Px::FromDouble(
+                50000.0 + static_cast<double>((r >> 16) & 0xFFF) * 0.1);
+            order.quantity = oms::Qty::FromDouble(
+                0.001 + static_cast<double>((r >> 28) & 0xFF) * 0.001);
+
+            if (manager.SubmitOrder(order)) {
+                id_high_water.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                ++stats.rejected;
+            }
+            ++stats.submitted;
+        }
+
+        if (burst_interval_ns > 0) {
+            next_due_ns += burst_interval_ns;
+            while (oms::TscClock::NowNanos() < next_due_ns &&
+                   running.load(std::memory_order_relaxed)) {
+                // busy-wait keeps burst edges sharp; yielding here
+                // would smear the pattern on loaded machines
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    LoadgenConfig config;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (arg == "--threads" && value) {
+            config.threads = std::strtoull(value, nullptr, 10);
+            ++i;
+        } else if (arg == "--duration" && value) {
+            config.duration_s = std::strtoull(value, nullptr, 10);
+            ++i;
+        } else if (arg == "--rate" && value) {
+            config.rate = std::strtoull(value, nullptr, 10);
+            ++i;
+        } else if (arg == "--symbols" && value) {
+            config.symbols = std::strtoull(value, nullptr, 10);
+            ++i;
+        } else if (arg == "--cancel-ratio" && value) {
+            config.cancel_ratio = std::strtod(value, nullptr);
+            ++i;
+        } else if (arg == "--burst" && value) {
+            config.burst = std::strtoull(value, nullptr, 10);
+            ++i;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (config.threads == 0 || config.burst == 0 || config.symbols == 0) {
+        std::cerr << "threads, burst and symbols must be > 0" << std::endl;
+        return 1;
+    }
+    if (config.symbols > kMaxSymbols) {
+        config.symbols = kMaxSymbols;
+    }
+
+    oms::OrderManager::Config manager_config;
+    // Several producers hit the same exchange queue, and the soak should
+    // measure the engine, not the per-exchange token bucket
+    manager_config.default_queue_mode = oms::QueueMode::MPMC;
+    manager_config.max_orders_per_second = 10000000;
+
+    oms::OrderManager manager(manager_config);
+
+    // Fused pre-trade pipeline: risk-check each drained batch inside
+    // the processing loop, the way the live deployment runs it
+    oms::risk::RiskEngine risk_engine{oms::risk::RiskConfig{}};
+    risk_engine.start();
+    manager.SetRiskEngine(&risk_engine);
+
+    manager.Start();
+
+    std::cout << "Soak: " << config.threads << " producers, "
+              << config.duration_s << "s, target "
+              << (config.rate > 0 ? std::to_string(config.rate) : "max")
+              << " orders/sec, " << config.symbols << " symbols, cancel ratio "
+              << config.cancel_ratio << ", burst " << config.burst << std::endl;
+
+    std::atomic<bool> running{true};
+    std::atomic<uint64_t> id_high_water{0};
+    std::vector<ProducerStats> producer_stats(config.threads);
+    std::vector<std::thread> producers;
+    producers.reserve(config.threads);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < config.threads; ++i) {
+        producers.emplace_back(ProducerLoop, std::ref(manager), std::cref(config),
+                               i, std::ref(running), std::ref(id_high_water),
+                               std::ref(producer_stats[i]));
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(config.duration_s));
+    running.store(false);
+    for (auto& thread : producers) {
+        thread.join();
+    }
+    const double elapsed_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+            .count();
+
+    // Let the processing threads drain the queues before reading stats
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    manager.Stop();
+    risk_engine.stop();
+
+    uint64_t risk_rejections = 0;
+    oms::OrderRecord rejected;
+    while (manager.GetNextRejection(rejected)) {
+        ++risk_rejections;
+    }
+
+    ProducerStats total;
+    for (const auto& stats : producer_stats) {
+        total.submitted += stats.submitted;
+        total.cancels += stats.cancels;
+        total.rejected += stats.rejected;
+    }
+
+    const auto& stats = manager.GetStats();
+    const uint64_t processed = stats.orders_processed.load();
+    const auto percentiles =
+        manager.GetLatencyPercentiles({0.5, 0.9, 0.99, 0.999});
+
+    std::cout << "\n=== Soak Results ===" << std::endl;
+    std::cout << "Submitted: " << total.submitted
+              << " (+ " << total.cancels << " cancels), rejected at submit: "
+              << total.rejected << std::endl;
+    std::cout << "Processed: " << processed << " ("
+              << static_cast<uint64_t>(static_cast<double>(processed) / elapsed_s)
+              << " orders/sec over " << elapsed_s << "s)" << std::endl;
+    std::cout << "Rejected by engine: " << stats.orders_rejected.load()
+              << " (risk rejections drained: " << risk_rejections << ")" << std::endl;
+    std::cout << "Latency us: min " << stats.min_latency_us.load()
+              << " / max " << stats.max_latency_us.load() << std::endl;
+    std::cout << "Percentiles us: p50 " << percentiles[0]
+              << "  p90 " << percentiles[1]
+              << "  p99 " << percentiles[2]
+              << "  p99.9 " << percentiles[3] << std::endl;
+    std::cout << "====================" << std::endl;
+
+    return 0;
+}
@@ -9,6 +9,7 @@
 #endif
 
 #include "types.h"
+#include "async_logger.h"
 #include "strategies/arbitrage_detector.h"
 #include "strategies/market_maker.h"
 #include "risk/risk_engine.h"
@@ -80,6 +81,9 @@ int main(int /*argc*/, char* /*argv*/[]) {
         oms::strategies::MarketMakerEngine mm_engine(mm_config);
         
         // Start components
+        oms::AsyncLogger::Instance().Start();
+        std::cout << "Async logger started" << std::endl;
+
         risk_engine.start();
         std::cout << "Risk Engine started" << std::endl;
         
@@ -98,17 +102,19 @@ int main(int /*argc*/, char* /*argv*/[]) {
         while (g_running) {
             auto now = std::chrono::steady_clock::now();
             
-            // Print statistics every 10 seconds
+            // Emit statistics every 10 seconds (formatted off-thread)
             if (now - last_stats_time >= stats_interval) {
-                std::cout << "\n=== Performance Stats ===" << std::endl;
-                std::cout << "Risk checks: " << risk_engine.getTotalChecks() 
-                          << " (avg latency: " << risk_engine.getAverageLatencyUs() << " µs)" << std::endl;
-                std::cout << "Arbitrage opportunities: " << arb_detector.getDetectedCount() 
-                          << " (processed: " << arb_detector.getProcessedPrices() << ")" << std::endl;
-                std::cout << "Market maker quotes: " << mm_engine.getQuotesGenerated() 
-                          << " (updates: " << mm_engine.getMarketUpdates() << ")" << std::endl;
-                std::cout << "========================" << std::endl;
-                
+                auto& logger = oms::AsyncLogger::Instance();
+                logger.Log(oms::LogEvent::STATS_RISK,
+                           static_cast<double>(risk_engine.getTotalChecks()),
+                           risk_engine.getAverageLatencyUs());
+                logger.Log(oms::LogEvent::STATS_ARBITRAGE,
+                           static_cast<double>(arb_detector.getDetectedCount()),
+                           static_cast<double>(arb_detector.getProcessedPrices()));
+                logger.Log(oms::LogEvent::STATS_MARKET_MAKER,
+                           static_cast<double>(mm_engine.getQuotesGenerated()),
+                           static_cast<double>(mm_engine.getMarketUpdates()));
+
                 last_stats_time = now;
             }
             
@@ -121,6 +127,7 @@ int main(int /*argc*/, char* /*argv*/[]) {
         mm_engine.stop();
         arb_detector.stop();
         risk_engine.stop();
+        oms::AsyncLogger::Instance().Stop();
         
         std::cout << "OMS Core Engine stopped successfully." << std::endl;
         
@@ -0,0 +1,167 @@
+#include "market_data_capture.h"
+
+#include <chrono>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "tsc_clock.h"
+
+namespace oms {
+
+std::unique_ptr<MarketDataCapture> MarketDataCapture::Create(const std::string& path) {
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return nullptr;
+    }
+
+    FileHeader header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.record_size = sizeof(CaptureRecord);
+    if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+        std::fclose(file);
+        return nullptr;
+    }
+
+    return std::unique_ptr<MarketDataCapture>(new MarketDataCapture(file));
+}
+
+MarketDataCapture::MarketDataCapture(FILE* file)
+    : file_(file), ring_(RING_SIZE) {}
+
+MarketDataCapture::~MarketDataCapture() {
+    Stop();
+    if (file_ != nullptr) {
+        std::fclose(file_);
+    }
+}
+
+void MarketDataCapture::RecordArbitrage(const char* exchange, const char* symbol,
+                                        double bid_price, double bid_quantity,
+                                        double ask_price, double ask_quantity) {
+    CaptureRecord record{};
+    record.timestamp_ns = TscClock::NowNanos();
+    record.bid_price = bid_price;
+    record.bid_quantity = bid_quantity;
+    record.ask_price = ask_price;
+    record.ask_quantity = ask_quantity;
+    std::strncpy(record.exchange, exchange, sizeof(record.exchange) - 1);
+    std::strncpy(record.symbol, symbol, sizeof(record.symbol) - 1);
+    record.target = static_cast<uint8_t>(CaptureTarget::ARBITRAGE);
+    Push(record);
+}
+
+void MarketDataCapture::RecordMarketMaker(const char* symbol,
+                                          double bid_price, double bid_size,
+                                          double ask_price, double ask_size,
+                                          double last_price) {
+    CaptureRecord record{};
+    record.timestamp_ns = TscClock::NowNanos();
+    record.bid_price = bid_price;
+    record.bid_quantity = bid_size;
+    record.ask_price = ask_price;
+    record.ask_quantity = ask_size;
+    record.last_price = last_price;
+    std::strncpy(record.symbol, symbol, sizeof(record.symbol) - 1);
+    record.target = static_cast<uint8_t>(CaptureTarget::MARKET_MAKER);
+    Push(record);
+}
+
+void MarketDataCapture::Push(const CaptureRecord& record) {
+    if (!ring_.push(record)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void MarketDataCapture::Start() {
+    if (running_.exchange(true)) {
+        return; // Already running
+    }
+    writer_thread_ = std::thread([this] { WriterLoop(); });
+}
+
+void MarketDataCapture::Stop() {
+    if (!running_.exchange(false)) {
+        return; // Already stopped
+    }
+    if (writer_thread_.joinable()) {
+        writer_thread_.join();
+    }
+    DrainOnce();
+    std::fflush(file_);
+}
+
+void MarketDataCapture::WriterLoop() {
+    while (running_.load(std::memory_order_acquire)) {
+        if (DrainOnce() == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+size_t MarketDataCapture::DrainOnce() {
+    static constexpr size_t kBatchSize = 256;
+    CaptureRecord batch[kBatchSize];
+
+    size_t total = 0;
+    size_t count;
+    while ((count = ring_.pop_batch(batch, kBatchSize)) > 0) {
+        const size_t written = std::fwrite(batch, sizeof(CaptureRecord), count, file_);
+        written_.fetch_add(written, std::memory_order_relaxed);
+        total += count;
+    }
+    return total;
+}
+
+std::unique_ptr<CaptureReader> CaptureReader::Open(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(MarketDataCapture::FileHeader)) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    void* base = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps the file alive
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const auto* header = static_cast<const MarketDataCapture::FileHeader*>(base);
+    if (header->magic != MarketDataCapture::MAGIC ||
+        header->version != MarketDataCapture::VERSION ||
+        header->record_size != sizeof(CaptureRecord)) {
+        ::munmap(base, size);
+        return nullptr;
+    }
+
+    const auto* records = reinterpret_cast<const CaptureRecord*>(
+        static_cast<const char*>(base) + sizeof(MarketDataCapture::FileHeader));
+    const size_t count =
+        (size - sizeof(MarketDataCapture::FileHeader)) / sizeof(CaptureRecord);
+
+    return std::unique_ptr<CaptureReader>(
+        new CaptureReader(base, size, records, count));
+}
+
+CaptureReader::CaptureReader(void* base, size_t size,
+                             const CaptureRecord* records, size_t count)
+    : base_(base), size_(size), records_(records), count_(count) {}
+
+CaptureReader::~CaptureReader() {
+    if (base_ != nullptr) {
+        ::munmap(base_, size_);
+    }
+}
+
+} // namespace oms
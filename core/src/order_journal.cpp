@@ -0,0 +1,193 @@
+#include "order_journal.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace oms {
+
+namespace {
+constexpr uint32_t kJournalMagic = 0x4C4A4F31; // "1OJL"
+constexpr uint32_t kJournalVersion = 1;
+
+bool IsPowerOfTwo(size_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+} // namespace
+
+// On-disk header, one cache line for metadata and one for the commit
+// cursor so the writer's stores don't share a line with read-only fields
+struct OrderJournal::FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;
+    uint64_t record_size;
+    uint8_t pad0[40];
+    uint64_t committed_seq; // accessed via atomic_ref
+    uint8_t pad1[56];
+};
+
+std::unique_ptr<OrderJournal> OrderJournal::Open(const std::string& path,
+                                                 size_t capacity) {
+    static_assert(sizeof(FileHeader) == 128,
+                  "journal header layout is part of the on-disk format");
+
+    if (!IsPowerOfTwo(capacity)) {
+        return nullptr;
+    }
+
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0660);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    const size_t size = sizeof(FileHeader) + capacity * sizeof(Record);
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    const bool fresh = static_cast<size_t>(st.st_size) != size;
+    if (fresh) {
+        if (::ftruncate(fd, 0) != 0 ||
+            ::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            return nullptr;
+        }
+        // Preallocate the blocks up front so appends never stall on
+        // delayed allocation
+        (void)::posix_fallocate(fd, 0, static_cast<off_t>(size));
+    }
+
+    void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        ::close(fd);
+        return nullptr;
+    }
+
+#ifdef MADV_HUGEPAGE
+    // Best effort: back the mapping with huge pages where the kernel
+    // supports them for file mappings; harmless no-op otherwise
+    (void)::madvise(base, size, MADV_HUGEPAGE);
+#endif
+
+    auto* header = static_cast<FileHeader*>(base);
+    if (fresh) {
+        std::memset(header, 0, sizeof(*header));
+        header->capacity = capacity;
+        header->record_size = sizeof(Record);
+        header->version = kJournalVersion;
+        header->magic = kJournalMagic;
+    } else if (header->magic != kJournalMagic ||
+               header->version != kJournalVersion ||
+               header->capacity != capacity ||
+               header->record_size != sizeof(Record)) {
+        ::munmap(base, size);
+        ::close(fd);
+        return nullptr;
+    }
+
+    return std::unique_ptr<OrderJournal>(
+        new OrderJournal(base, size, fd, capacity));
+}
+
+OrderJournal::OrderJournal(void* base, size_t size, int fd, size_t capacity)
+    : base_(base), size_(size), fd_(fd), capacity_(capacity),
+      header_(static_cast<FileHeader*>(base)),
+      slots_(reinterpret_cast<Record*>(static_cast<char*>(base) + sizeof(FileHeader))),
+      inlet_(INLET_RING_SIZE) {}
+
+OrderJournal::~OrderJournal() {
+    Stop();
+    if (base_ != nullptr) {
+        ::munmap(base_, size_);
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+bool OrderJournal::Append(Event event, const OrderRecord& order) {
+    Record record;
+    record.order = order;
+    record.event = event;
+    std::memset(record.reserved, 0, sizeof(record.reserved));
+
+    if (!inlet_.push(record)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void OrderJournal::Start() {
+    if (running_.exchange(true)) {
+        return; // Already running
+    }
+    writer_thread_ = std::thread([this] { WriterLoop(); });
+}
+
+void OrderJournal::Stop() {
+    if (!running_.exchange(false)) {
+        return; // Already stopped
+    }
+    if (writer_thread_.joinable()) {
+        writer_thread_.join();
+    }
+    // Flush whatever the processing threads appended after the last drain
+    DrainOnce();
+}
+
+void OrderJournal::WriterLoop() {
+    while (running_.load(std::memory_order_acquire)) {
+        if (DrainOnce() == 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+size_t OrderJournal::DrainOnce() {
+    static constexpr size_t kBatchSize = 256;
+    Record batch[kBatchSize];
+
+    std::atomic_ref<uint64_t> committed(header_->committed_seq);
+    uint64_t seq = committed.load(std::memory_order_relaxed);
+
+    size_t total = 0;
+    size_t count;
+    while ((count = inlet_.pop_batch(batch, kBatchSize)) > 0) {
+        for (size_t i = 0; i < count; ++i) {
+            slots_[(seq + i) & (capacity_ - 1)] = batch[i];
+        }
+        seq += count;
+        // Publish once per batch; a crash loses at most the batch in
+        // flight, never yields a half-visible record
+        committed.store(seq, std::memory_order_release);
+        total += count;
+    }
+    return total;
+}
+
+void OrderJournal::Replay(const std::function<void(const Record&)>& fn) const {
+    std::atomic_ref<const uint64_t> committed(header_->committed_seq);
+    const uint64_t end = committed.load(std::memory_order_acquire);
+    const uint64_t begin = end > capacity_ ? end - capacity_ : 0;
+
+    for (uint64_t seq = begin; seq < end; ++seq) {
+        fn(slots_[seq & (capacity_ - 1)]);
+    }
+}
+
+uint64_t OrderJournal::CommittedRecords() const {
+    return std::atomic_ref<const uint64_t>(header_->committed_seq)
+        .load(std::memory_order_acquire);
+}
+
+} // namespace oms
@@ -1,4 +1,6 @@
 #include "risk/risk_engine.h"
+#include "async_logger.h"
+#include "tsc_clock.h"
 #include <algorithm>
 #include <numeric>
 
@@ -26,16 +28,16 @@ RiskEngine::RiskEngine(const RiskConfig& config)
 
 void RiskEngine::start() {
     running_ = true;
-    log("Risk Engine started");
+    AsyncLogger::Instance().Log(LogEvent::RISK_ENGINE_STARTED);
 }
 
 void RiskEngine::stop() {
     running_ = false;
-    log("Risk Engine stopped");
+    AsyncLogger::Instance().Log(LogEvent::RISK_ENGINE_STOPPED);
 }
 
 bool RiskEngine::checkOrder(const Order& order) {
-    auto start = std::chrono::steady_clock::now();
+    const uint64_t start_ns = TscClock::NowNanos();
     
     if (!running_) {
         return false;
@@ -45,19 +47,31 @@ bool RiskEngine::checkOrder(const Order& order) {
     bool passed = true;
     
     // 1. Check order value limit
-    double order_value = order.price * order.quantity;
+    double order_value = Notional(order.price, order.quantity);
     if (order_value > config_.max_order_value) {
-        log("Order value exceeds limit: " + std::to_string(order_value));
+        AsyncLogger::Instance().Log(LogEvent::RISK_ORDER_VALUE_LIMIT, order_value);
         passed = false;
     }
     
     // 2. Check position limit
     if (passed) {
-        auto& pos = positions_[hashSymbol(order.symbol) % MAX_SYMBOLS];
+        // Orders normally arrive with the id already interned; fall back
+        // to the registry for callers that only filled the string
+        SymbolId symbol_id = order.symbol_id;
+        if (symbol_id == kInvalidSymbolId) {
+            symbol_id = SymbolRegistry::Instance().Intern(order.symbol.c_str());
+        }
+        if (symbol_id == kInvalidSymbolId) {
+            AsyncLogger::Instance().Log(LogEvent::RISK_SYMBOL_REGISTRY_FULL);
+            passed = false;
+        }
+
+        auto& pos = positions_[symbol_id != kInvalidSymbolId ? symbol_id : 0];
         double new_position_value = pos.value + (order.side == Side::BUY ? order_value : -order_value);
         
         if (std::abs(new_position_value) > config_.max_position_value) {
-            log("Position value would exceed limit: " + std::to_string(new_position_value));
+            AsyncLogger::Instance().Log(LogEvent::RISK_POSITION_LIMIT,
+                                        new_position_value);
             passed = false;
         }
     }
@@ -65,7 +79,8 @@ bool RiskEngine::checkOrder(const Order& order) {
     // 3. Check daily loss limit
     if (passed) {
         if (daily_pnl_.load() < -config_.daily_loss_limit) {
-            log("Daily loss limit exceeded: " + std::to_string(daily_pnl_.load()));
+            AsyncLogger::Instance().Log(LogEvent::RISK_DAILY_LOSS_LIMIT,
+                                        daily_pnl_.load());
             passed = false;
         }
     }
@@ -73,23 +88,150 @@ bool RiskEngine::checkOrder(const Order& order) {
     // 4. Check open orders limit
     if (passed) {
         if (open_orders_.load() >= config_.max_open_orders) {
-            log("Open orders limit exceeded: " + std::to_string(open_orders_.load()));
+            AsyncLogger::Instance().Log(LogEvent::RISK_OPEN_ORDERS_LIMIT,
+                                        open_orders_.load());
             passed = false;
         }
     }
     
     // Update metrics
-    auto end = std::chrono::steady_clock::now();
-    auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
-    
+    const uint64_t latency = TscClock::NowNanos() - start_ns;
+
     total_checks_++;
     total_latency_ns_ += latency;
+    latency_histogram_ns_.Record(latency);
     
     return passed;
 }
 
+size_t RiskEngine::checkOrders(const Order* orders, size_t count, uint8_t* results) {
+    const uint64_t start_ns = TscClock::NowNanos();
+
+    if (!running_ || count == 0) {
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = 0;
+        }
+        return 0;
+    }
+
+    // Hoist config and engine-wide state out of the loop; these are the
+    // same for every order in the batch
+    const double max_order_value = config_.max_order_value;
+    const double max_position_value = config_.max_position_value;
+    const bool daily_ok = daily_pnl_.load(std::memory_order_relaxed)
+                          >= -config_.daily_loss_limit;
+    const bool orders_ok = open_orders_.load(std::memory_order_relaxed)
+                           < config_.max_open_orders;
+    const bool global_ok = daily_ok && orders_ok;
+
+    size_t passed_count = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        const Order& order = orders[i];
+
+        SymbolId symbol_id = order.symbol_id;
+        if (symbol_id == kInvalidSymbolId) {
+            symbol_id = SymbolRegistry::Instance().Intern(order.symbol.c_str());
+        }
+        const bool symbol_ok = (symbol_id != kInvalidSymbolId);
+
+        const double order_value = Notional(order.price, order.quantity);
+        const double signed_value =
+            (order.side == Side::BUY) ? order_value : -order_value;
+
+        const auto& pos = positions_[symbol_ok ? symbol_id : 0];
+        const double new_position_value =
+            pos.value.load(std::memory_order_relaxed) + signed_value;
+
+        // All limit predicates evaluate unconditionally and combine with
+        // bitwise and - no early-exit branches for the predictor to miss
+        const uint8_t ok =
+            static_cast<uint8_t>(order_value <= max_order_value) &
+            static_cast<uint8_t>(std::abs(new_position_value) <= max_position_value) &
+            static_cast<uint8_t>(global_ok) &
+            static_cast<uint8_t>(symbol_ok);
+
+        results[i] = ok;
+        passed_count += ok;
+    }
+
+    // One timing read and one set of counter updates for the whole batch
+    const uint64_t latency = TscClock::NowNanos() - start_ns;
+    total_checks_ += count;
+    total_latency_ns_ += latency;
+    latency_histogram_ns_.Record(latency / count);
+
+    return passed_count;
+}
+
+size_t RiskEngine::checkOrders(const OrderRecord* records, size_t count,
+                               uint8_t* results) {
+    const uint64_t start_ns = TscClock::NowNanos();
+
+    if (!running_ || count == 0) {
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = 0;
+        }
+        return 0;
+    }
+
+    const double max_order_value = config_.max_order_value;
+    const double max_position_value = config_.max_position_value;
+    const bool daily_ok = daily_pnl_.load(std::memory_order_relaxed)
+                          >= -config_.daily_loss_limit;
+    const bool orders_ok = open_orders_.load(std::memory_order_relaxed)
+                           < config_.max_open_orders;
+    const bool global_ok = daily_ok && orders_ok;
+
+    size_t passed_count = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        const OrderRecord& record = records[i];
+
+        SymbolId symbol_id = record.symbol_id;
+        if (symbol_id == kInvalidSymbolId) {
+            symbol_id = SymbolRegistry::Instance().Intern(record.symbol);
+        }
+        const bool symbol_ok = (symbol_id != kInvalidSymbolId);
+
+        // Records carry wire-format doubles; the limits are stated in
+        // doubles too, so no fixed-point round trip is needed here
+        const double order_value = record.price * record.quantity;
+        const double signed_value =
+            (record.side == Side::BUY) ? order_value : -order_value;
+
+        const auto& pos = positions_[symbol_ok ? symbol_id : 0];
+        const double new_position_value =
+            pos.value.load(std::memory_order_relaxed) + signed_value;
+
+        const uint8_t ok =
+            static_cast<uint8_t>(order_value <= max_order_value) &
+            static_cast<uint8_t>(std::abs(new_position_value) <= max_position_value) &
+            static_cast<uint8_t>(global_ok) &
+            static_cast<uint8_t>(symbol_ok);
+
+        results[i] = ok;
+        passed_count += ok;
+    }
+
+    const uint64_t latency = TscClock::NowNanos() - start_ns;
+    total_checks_ += count;
+    total_latency_ns_ += latency;
+    latency_histogram_ns_.Record(latency / count);
+
+    return passed_count;
+}
+
 void RiskEngine::updatePosition(const std::string& symbol, double quantity, double price) {
-    auto& pos = positions_[hashSymbol(symbol) % MAX_SYMBOLS];
+    const SymbolId symbol_id = SymbolRegistry::Instance().Intern(symbol.c_str());
+    if (symbol_id == kInvalidSymbolId) {
+        return; // Registry full
+    }
+    updatePosition(symbol_id, quantity, price);
+}
+
+void RiskEngine::updatePosition(SymbolId symbol_id, double quantity, double price) {
+    auto& pos = positions_[symbol_id];
     
     // Update position
     double old_quantity = pos.quantity.load();
@@ -131,7 +273,7 @@ double RiskEngine::getTotalExposure() const {
 
 void RiskEngine::resetDailyPnL() {
     daily_pnl_ = 0.0;
-    log("Daily PnL reset");
+    AsyncLogger::Instance().Log(LogEvent::RISK_DAILY_PNL_RESET);
 }
 
 size_t RiskEngine::getTotalChecks() const {
@@ -145,23 +287,8 @@ double RiskEngine::getAverageLatencyUs() const {
     return static_cast<double>(total_latency_ns_.load()) / checks / 1000.0;
 }
 
-void RiskEngine::log(const std::string& message) {
-    // In production, this would write to a proper logging system
-    // For now, we'll just store in a buffer
-    static std::atomic<size_t> log_index{0};
-    static std::array<std::string, 1000> log_buffer;
-    
-    size_t idx = log_index.fetch_add(1) % log_buffer.size();
-    log_buffer[idx] = "[RiskEngine] " + message;
-}
-
-size_t RiskEngine::hashSymbol(const std::string& symbol) {
-    // Simple hash function for symbol
-    size_t hash = 0;
-    for (char c : symbol) {
-        hash = hash * 31 + c;
-    }
-    return hash;
+std::vector<uint64_t> RiskEngine::getLatencyPercentilesNs(const std::vector<double>& ps) const {
+    return latency_histogram_ns_.GetPercentiles(ps);
 }
 
 double RiskEngine::calculateRealizedPnL(double old_quantity, double old_price, 
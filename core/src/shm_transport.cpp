@@ -0,0 +1,199 @@
+#include "shm_transport.h"
+
+#include <atomic>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace oms {
+
+// The C ABI mirrors the C++ record layouts field for field; if either
+// side drifts, fail the build instead of corrupting the wire
+static_assert(sizeof(OmsShmMarketData) == sizeof(MarketDataRecord),
+              "shm ABI out of sync with MarketDataRecord");
+static_assert(offsetof(OmsShmMarketData, symbol) == offsetof(MarketDataRecord, symbol),
+              "shm ABI out of sync with MarketDataRecord");
+static_assert(sizeof(OmsShmOrder) == sizeof(OrderRecord),
+              "shm ABI out of sync with OrderRecord");
+static_assert(offsetof(OmsShmOrder, price) == offsetof(OrderRecord, price),
+              "shm ABI out of sync with OrderRecord");
+static_assert(offsetof(OmsShmOrder, created_at_us) == offsetof(OrderRecord, created_at),
+              "shm ABI out of sync with OrderRecord");
+
+namespace {
+
+bool IsPowerOfTwo(size_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+size_t RegionSize(size_t market_data_capacity, size_t order_capacity) {
+    return sizeof(OmsShmRegionHeader) +
+           market_data_capacity * sizeof(OmsShmMarketData) +
+           order_capacity * sizeof(OmsShmOrder);
+}
+
+} // namespace
+
+std::unique_ptr<ShmTransport> ShmTransport::Create(const std::string& path,
+                                                   size_t market_data_capacity,
+                                                   size_t order_capacity) {
+    if (!IsPowerOfTwo(market_data_capacity) || !IsPowerOfTwo(order_capacity)) {
+        return nullptr;
+    }
+
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0660);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    const size_t size = RegionSize(market_data_capacity, order_capacity);
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    auto* header = static_cast<OmsShmRegionHeader*>(base);
+    std::memset(header, 0, sizeof(*header));
+    header->total_size = size;
+
+    header->market_data.capacity = market_data_capacity;
+    header->market_data.record_size = sizeof(OmsShmMarketData);
+    header->market_data.data_offset = sizeof(OmsShmRegionHeader);
+
+    header->orders.capacity = order_capacity;
+    header->orders.record_size = sizeof(OmsShmOrder);
+    header->orders.data_offset = sizeof(OmsShmRegionHeader) +
+                                 market_data_capacity * sizeof(OmsShmMarketData);
+
+    // Publish magic last so a concurrent Open never sees a
+    // half-initialized header
+    header->version = OMS_SHM_VERSION;
+    std::atomic_thread_fence(std::memory_order_release);
+    std::atomic_ref<uint32_t>(header->magic).store(OMS_SHM_MAGIC,
+                                                   std::memory_order_release);
+
+    return std::unique_ptr<ShmTransport>(new ShmTransport(base, size, fd));
+}
+
+std::unique_ptr<ShmTransport> ShmTransport::Open(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(OmsShmRegionHeader)) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    auto* header = static_cast<OmsShmRegionHeader*>(base);
+    if (std::atomic_ref<uint32_t>(header->magic).load(std::memory_order_acquire) != OMS_SHM_MAGIC ||
+        header->version != OMS_SHM_VERSION ||
+        header->total_size != size ||
+        header->market_data.record_size != sizeof(OmsShmMarketData) ||
+        header->orders.record_size != sizeof(OmsShmOrder)) {
+        ::munmap(base, size);
+        ::close(fd);
+        return nullptr;
+    }
+
+    return std::unique_ptr<ShmTransport>(new ShmTransport(base, size, fd));
+}
+
+ShmTransport::ShmTransport(void* base, size_t size, int fd)
+    : base_(base), size_(size), fd_(fd),
+      header_(static_cast<OmsShmRegionHeader*>(base)) {}
+
+ShmTransport::~ShmTransport() {
+    if (base_ != nullptr) {
+        ::munmap(base_, size_);
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+bool ShmTransport::push(OmsShmQueue& queue, const void* record) {
+    std::atomic_ref<uint64_t> head(queue.head);
+    std::atomic_ref<uint64_t> tail(queue.tail);
+
+    const uint64_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= queue.capacity) {
+        return false; // Full
+    }
+
+    char* slot = static_cast<char*>(base_) + queue.data_offset +
+                 (h & (queue.capacity - 1)) * queue.record_size;
+    std::memcpy(slot, record, queue.record_size);
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+bool ShmTransport::pop(OmsShmQueue& queue, void* record) {
+    return popBatch(queue, record, 1) == 1;
+}
+
+size_t ShmTransport::popBatch(OmsShmQueue& queue, void* records, size_t max_records) {
+    std::atomic_ref<uint64_t> head(queue.head);
+    std::atomic_ref<uint64_t> tail(queue.tail);
+
+    const uint64_t t = tail.load(std::memory_order_relaxed);
+    const uint64_t available = head.load(std::memory_order_acquire) - t;
+    if (available == 0) {
+        return 0;
+    }
+
+    const size_t count = available < max_records ? available : max_records;
+    char* out = static_cast<char*>(records);
+    for (size_t i = 0; i < count; ++i) {
+        const char* slot = static_cast<const char*>(base_) + queue.data_offset +
+                           ((t + i) & (queue.capacity - 1)) * queue.record_size;
+        std::memcpy(out + i * queue.record_size, slot, queue.record_size);
+    }
+    tail.store(t + count, std::memory_order_release);
+    return count;
+}
+
+bool ShmTransport::pushMarketData(const MarketDataRecord& record) {
+    return push(header_->market_data, &record);
+}
+
+bool ShmTransport::popMarketData(MarketDataRecord& record) {
+    return pop(header_->market_data, &record);
+}
+
+size_t ShmTransport::popMarketDataBatch(MarketDataRecord* records, size_t max_records) {
+    return popBatch(header_->market_data, records, max_records);
+}
+
+bool ShmTransport::pushOrder(const OrderRecord& record) {
+    return push(header_->orders, &record);
+}
+
+bool ShmTransport::popOrder(OrderRecord& record) {
+    return pop(header_->orders, &record);
+}
+
+size_t ShmTransport::popOrderBatch(OrderRecord* records, size_t max_records) {
+    return popBatch(header_->orders, records, max_records);
+}
+
+} // namespace oms
@@ -1,13 +1,21 @@
 #include "strategies/arbitrage_detector.h"
+#include "market_data_capture.h"
+#include "shm_transport.h"
+#include "tsc_clock.h"
 #include <cstring>
 #include <algorithm>
 #include <cstdio>
+#include <limits>
 
 namespace oms {
 namespace strategies {
 
 ArbitrageDetector::ArbitrageDetector(const ArbitrageConfig& config)
-    : config_(config), opportunity_buffer_(OPPORTUNITY_BUFFER_SIZE) {
+    : config_(config), opportunity_buffer_(OPPORTUNITY_BUFFER_SIZE),
+      dirty_queue_(DIRTY_QUEUE_SIZE) {
+    for (auto& local : id_to_local_) {
+        local.store(UINT16_MAX, std::memory_order_relaxed);
+    }
 }
 
 ArbitrageDetector::~ArbitrageDetector() {
@@ -17,6 +25,11 @@ ArbitrageDetector::~ArbitrageDetector() {
 void ArbitrageDetector::updatePriceFeed(const char* exchange, const char* symbol,
                                        double bid_price, double bid_quantity,
                                        double ask_price, double ask_quantity) {
+    if (capture_) {
+        capture_->RecordArbitrage(exchange, symbol, bid_price, bid_quantity,
+                                  ask_price, ask_quantity);
+    }
+
     // Get symbol index
     size_t sym_idx = getOrCreateSymbolIndex(symbol);
     if (sym_idx >= MAX_SYMBOLS) {
@@ -31,7 +44,7 @@ void ArbitrageDetector::updatePriceFeed(const char* exchange, const char* symbol
     uint8_t count = sym_prices.exchange_count.load(std::memory_order_acquire);
     
     for (uint8_t i = 0; i < count; ++i) {
-        if (std::strcmp(sym_prices.feeds[i].exchange, exchange) == 0) {
+        if (std::strcmp(sym_prices.exchange_names[i], exchange) == 0) {
             exchange_idx = i;
             break;
         }
@@ -41,14 +54,16 @@ void ArbitrageDetector::updatePriceFeed(const char* exchange, const char* symbol
     if (exchange_idx == -1) {
         if (count < MAX_EXCHANGES) {
             exchange_idx = count;
+            std::strncpy(sym_prices.exchange_names[exchange_idx], exchange,
+                         sizeof(sym_prices.exchange_names[exchange_idx]) - 1);
             sym_prices.exchange_count.fetch_add(1, std::memory_order_release);
         } else {
             return; // Exchange limit reached for this symbol
         }
     }
     
-    // Update price feed (atomic-like update)
-    PriceFeed& feed = sym_prices.feeds[exchange_idx];
+    // Publish a consistent snapshot; the writer never blocks
+    PriceFeed feed;
     std::strncpy(feed.exchange, exchange, sizeof(feed.exchange) - 1);
     std::strncpy(feed.symbol, symbol, sizeof(feed.symbol) - 1);
     feed.bid_price = bid_price;
@@ -56,7 +71,23 @@ void ArbitrageDetector::updatePriceFeed(const char* exchange, const char* symbol
     feed.ask_price = ask_price;
     feed.ask_quantity = ask_quantity;
     feed.timestamp_ns = getCurrentTimeNanos();
-    
+    sym_prices.feeds[exchange_idx].Store(feed);
+
+    // Keep the SoA mirror in sync; the detection scan reads only these
+    sym_prices.bid[exchange_idx] = bid_price;
+    sym_prices.ask[exchange_idx] = ask_price;
+    sym_prices.bid_qty[exchange_idx] = bid_quantity;
+    sym_prices.ask_qty[exchange_idx] = ask_quantity;
+    sym_prices.timestamp_ns[exchange_idx] = feed.timestamp_ns;
+
+    // Mark the symbol dirty once per detection pass; if the queue is
+    // momentarily full, clear the flag so the next tick can retry
+    if (!sym_prices.dirty.exchange(true, std::memory_order_acq_rel)) {
+        if (!dirty_queue_.push(static_cast<uint16_t>(sym_idx))) {
+            sym_prices.dirty.store(false, std::memory_order_release);
+        }
+    }
+
     processed_prices_.fetch_add(1, std::memory_order_relaxed);
 }
 
@@ -66,39 +97,69 @@ void ArbitrageDetector::detectOpportunities() {
     }
     
     uint64_t current_time = getCurrentTimeNanos();
-    size_t sym_count = symbol_count_.load(std::memory_order_acquire);
-    
-    // Check each symbol
-    for (size_t sym_idx = 0; sym_idx < sym_count; ++sym_idx) {
+
+    // Evaluate only symbols that ticked since the last pass. The flag
+    // is cleared before the scan so a tick arriving mid-scan re-queues
+    // the symbol rather than getting lost.
+    uint16_t sym_idx;
+    while (dirty_queue_.pop(sym_idx)) {
         SymbolPrices& sym_prices = symbol_prices_[sym_idx];
-        uint8_t exchange_count = sym_prices.exchange_count.load(std::memory_order_acquire);
-        
-        if (exchange_count < 2) {
-            continue; // Need at least 2 exchanges
-        }
-        
-        // Check all exchange pairs
-        for (uint8_t i = 0; i < exchange_count; ++i) {
-            const PriceFeed& feed_i = sym_prices.feeds[i];
-            
-            // Skip stale prices (older than 1 second)
-            if (current_time - feed_i.timestamp_ns > 1000000000) {
-                continue;
-            }
-            
-            for (uint8_t j = i + 1; j < exchange_count; ++j) {
-                const PriceFeed& feed_j = sym_prices.feeds[j];
-                
-                // Skip stale prices
-                if (current_time - feed_j.timestamp_ns > 1000000000) {
-                    continue;
-                }
-                
-                // Check both directions
-                checkArbitrageOpportunity(feed_i, feed_j, sym_prices.symbol);
-                checkArbitrageOpportunity(feed_j, feed_i, sym_prices.symbol);
-            }
-        }
+        sym_prices.dirty.store(false, std::memory_order_release);
+        scanSymbol(sym_prices, current_time);
+    }
+}
+
+void ArbitrageDetector::scanSymbol(SymbolPrices& sym_prices, uint64_t current_time) {
+    constexpr uint64_t kStaleNs = 1000000000; // Skip prices older than 1 second
+    constexpr double kNoAsk = std::numeric_limits<double>::infinity();
+
+    uint8_t exchange_count = sym_prices.exchange_count.load(std::memory_order_acquire);
+
+    if (exchange_count < 2) {
+        return; // Need at least 2 exchanges
+    }
+
+    // Mask stale and unset slots so they lose every comparison,
+    // then reduce. The widest spread is always best-bid vs
+    // best-ask, so the O(n^2) pair loop collapses to two
+    // reductions over the contiguous SoA arrays, which the
+    // compiler vectorizes (fixed trip count, no branches).
+    alignas(32) double bids[MAX_EXCHANGES];
+    alignas(32) double asks[MAX_EXCHANGES];
+    for (size_t i = 0; i < MAX_EXCHANGES; ++i) {
+        const bool fresh = i < exchange_count &&
+                           current_time - sym_prices.timestamp_ns[i] <= kStaleNs &&
+                           sym_prices.ask[i] > 0.0;
+        bids[i] = fresh ? sym_prices.bid[i] : 0.0;
+        asks[i] = fresh ? sym_prices.ask[i] : kNoAsk;
+    }
+
+    double best_bid = bids[0];
+    double best_ask = asks[0];
+    for (size_t i = 1; i < MAX_EXCHANGES; ++i) {
+        best_bid = std::max(best_bid, bids[i]);
+        best_ask = std::min(best_ask, asks[i]);
+    }
+
+    if (best_bid <= best_ask) {
+        return; // No crossed market anywhere
+    }
+
+    // Recover which exchanges produced the extremes
+    size_t bid_idx = 0;
+    size_t ask_idx = 0;
+    for (size_t i = 0; i < MAX_EXCHANGES; ++i) {
+        if (bids[i] == best_bid) bid_idx = i;
+        if (asks[i] == best_ask) ask_idx = i;
+    }
+
+    if (bid_idx != ask_idx) {
+        // Seqlock loads give consistent snapshots of the chosen
+        // pair; the SoA scan above is only candidate selection and
+        // checkArbitrageOpportunity re-verifies the spread
+        const PriceFeed buy = sym_prices.feeds[ask_idx].Load();
+        const PriceFeed sell = sym_prices.feeds[bid_idx].Load();
+        checkArbitrageOpportunity(buy, sell, sym_prices.symbol);
     }
 }
 
@@ -170,6 +231,31 @@ void ArbitrageDetector::checkArbitrageOpportunity(const PriceFeed& buy, const Pr
     }
 }
 
+size_t ArbitrageDetector::drainShmFeed(ShmTransport& shm, size_t max_records) {
+    static constexpr size_t kBatch = 64;
+    MarketDataRecord batch[kBatch];
+    size_t drained = 0;
+
+    while (drained < max_records) {
+        const size_t want = std::min(kBatch, max_records - drained);
+        const size_t count = shm.popMarketDataBatch(batch, want);
+        if (count == 0) {
+            break;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const MarketDataRecord& md = batch[i];
+            updatePriceFeed(ExchangeTypeName(md.exchange), md.symbol,
+                            md.bid_price, md.bid_quantity,
+                            md.ask_price, md.ask_quantity);
+        }
+
+        drained += count;
+    }
+
+    return drained;
+}
+
 bool ArbitrageDetector::getNextOpportunity(ArbitrageOpportunity& opportunity) {
     return opportunity_buffer_.pop(opportunity);
 }
@@ -183,28 +269,35 @@ void ArbitrageDetector::stop() {
 }
 
 size_t ArbitrageDetector::getOrCreateSymbolIndex(const char* symbol) {
-    std::string sym_str(symbol);
-    
-    // Check if symbol exists
-    auto it = symbol_index_.find(sym_str);
-    if (it != symbol_index_.end()) {
-        return it->second;
+    const SymbolId sid = SymbolRegistry::Instance().Intern(symbol);
+    if (sid == kInvalidSymbolId) {
+        return MAX_SYMBOLS; // Registry full
     }
-    
+
+    // Fast path: already mapped to a local slot
+    uint16_t local = id_to_local_[sid].load(std::memory_order_acquire);
+    if (local != UINT16_MAX) {
+        return local;
+    }
+
     // Create new symbol entry
     size_t new_idx = symbol_count_.fetch_add(1, std::memory_order_acq_rel);
     if (new_idx >= MAX_SYMBOLS) {
         symbol_count_.fetch_sub(1, std::memory_order_acq_rel);
         return MAX_SYMBOLS; // Limit reached
     }
-    
+
     // Initialize symbol entry
     SymbolPrices& sym_prices = symbol_prices_[new_idx];
     std::strncpy(sym_prices.symbol, symbol, sizeof(sym_prices.symbol) - 1);
-    
-    // Add to index
-    symbol_index_[sym_str] = new_idx;
-    
+
+    uint16_t expected = UINT16_MAX;
+    if (!id_to_local_[sid].compare_exchange_strong(expected, static_cast<uint16_t>(new_idx),
+                                                   std::memory_order_acq_rel)) {
+        // Another thread mapped this symbol first; use its slot
+        return expected;
+    }
+
     return new_idx;
 }
 
@@ -226,9 +319,7 @@ double ArbitrageDetector::calculateFee(const std::string& exchange, double price
 }
 
 uint64_t ArbitrageDetector::getCurrentTimeNanos() const {
-    return std::chrono::duration_cast<std::chrono::nanoseconds>(
-        std::chrono::steady_clock::now().time_since_epoch()
-    ).count();
+    return TscClock::NowNanos();
 }
 
 } // namespace strategies
@@ -1,23 +1,88 @@
 #include "strategies/market_maker.h"
+#include "market_data_capture.h"
+#include "tsc_clock.h"
 #include <cmath>
 #include <algorithm>
 #include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#include <pthread.h>
+#endif
 
 namespace oms {
 namespace strategies {
 
 MarketMakerEngine::MarketMakerEngine(const MarketMakerConfig& config)
-    : config_(config), quote_buffer_(QUOTE_BUFFER_SIZE) {
-    // Initialize price history
-    std::fill(price_history_.begin(), price_history_.end(), 0.0);
+    : config_(config) {
+    for (auto& local : id_to_local_) {
+        local.store(UINT16_MAX, std::memory_order_relaxed);
+    }
+
+    const size_t num_shards = config_.worker_cores.empty()
+                                  ? 1
+                                  : config_.worker_cores.size();
+    quote_buffers_.reserve(num_shards);
+    for (size_t i = 0; i < num_shards; ++i) {
+        quote_buffers_.push_back(
+            std::make_unique<oms::RingBuffer<MMQuote>>(QUOTE_BUFFER_SIZE));
+    }
 }
 
 MarketMakerEngine::~MarketMakerEngine() {
     stop();
 }
 
+size_t MarketMakerEngine::getOrCreateSymbolSlot(const char* symbol) {
+    const SymbolId sid = SymbolRegistry::Instance().Intern(symbol);
+    if (sid == kInvalidSymbolId) {
+        return MAX_SYMBOLS; // Registry full
+    }
+
+    // Fast path: already mapped to a local slot
+    uint16_t local = id_to_local_[sid].load(std::memory_order_acquire);
+    if (local != UINT16_MAX) {
+        return local;
+    }
+
+    size_t new_idx = symbol_count_.fetch_add(1, std::memory_order_acq_rel);
+    if (new_idx >= MAX_SYMBOLS) {
+        symbol_count_.fetch_sub(1, std::memory_order_acq_rel);
+        return MAX_SYMBOLS; // Limit reached
+    }
+
+    SymbolState& state = symbols_[new_idx];
+    std::strncpy(state.symbol, symbol, sizeof(state.symbol) - 1);
+    // Initial round-robin placement; the rebalancer refines it
+    const auto initial_shard =
+        static_cast<uint16_t>(new_idx % quote_buffers_.size());
+    state.shard.store(initial_shard, std::memory_order_relaxed);
+    state.next_shard.store(initial_shard, std::memory_order_relaxed);
+
+    uint16_t expected = UINT16_MAX;
+    if (!id_to_local_[sid].compare_exchange_strong(expected, static_cast<uint16_t>(new_idx),
+                                                   std::memory_order_acq_rel)) {
+        // Another thread mapped this symbol first; use its slot
+        return expected;
+    }
+
+    return new_idx;
+}
+
 void MarketMakerEngine::updateMarketData(const char* symbol, double bid_price, double bid_size,
                                         double ask_price, double ask_size, double last_price) {
+    if (capture_) {
+        capture_->RecordMarketMaker(symbol, bid_price, bid_size,
+                                    ask_price, ask_size, last_price);
+    }
+
+    size_t idx = getOrCreateSymbolSlot(symbol);
+    if (idx >= MAX_SYMBOLS) {
+        return;
+    }
+    SymbolState& state = symbols_[idx];
+
     MarketSnapshot new_state;
     new_state.bid_price = bid_price;
     new_state.ask_price = ask_price;
@@ -27,20 +92,23 @@ void MarketMakerEngine::updateMarketData(const char* symbol, double bid_price, d
     new_state.ask_size = ask_size;
     new_state.timestamp_ns = getCurrentTimeNanos();
     
-    // Update price history for volatility calculation
-    size_t idx = price_index_.fetch_add(1) % PRICE_HISTORY_SIZE;
-    price_history_[idx] = new_state.mid_price;
+    // O(1) incremental volatility update; the quoting worker just reads
+    // the precomputed value from the snapshot
+    new_state.volatility = updateVolatility(state, new_state.mid_price);
     
-    // Calculate volatility
-    new_state.volatility = calculateVolatility();
-    
-    // Update market state
-    market_state_ = new_state;
-    market_version_.fetch_add(1);
+    // Update market state and signal the owning worker
+    state.market.Store(new_state);
+    state.tick_seq.fetch_add(1, std::memory_order_release);
     market_updates_.fetch_add(1);
 }
 
 void MarketMakerEngine::updatePosition(const char* symbol, double position, double avg_price) {
+    size_t idx = getOrCreateSymbolSlot(symbol);
+    if (idx >= MAX_SYMBOLS) {
+        return;
+    }
+    SymbolState& state = symbols_[idx];
+
     InventorySnapshot new_state;
     new_state.position = position;
     new_state.avg_price = avg_price;
@@ -48,20 +116,121 @@ void MarketMakerEngine::updatePosition(const char* symbol, double position, doub
     new_state.timestamp_ns = getCurrentTimeNanos();
     
     // Calculate unrealized PnL
-    MarketSnapshot market = market_state_;
+    MarketSnapshot market = state.market.Load();
     if (market.mid_price > 0) {
         new_state.unrealized_pnl = position * (market.mid_price - avg_price);
     }
     
-    inventory_state_ = new_state;
-    inventory_version_.fetch_add(1);
+    state.inventory.Store(new_state);
 }
 
-void MarketMakerEngine::generateQuotes() {
-    if (!running_.load()) return;
-    
-    MarketSnapshot market = market_state_;
-    InventorySnapshot inventory = inventory_state_;
+void MarketMakerEngine::workerLoop(size_t shard, int cpu_core) {
+#ifdef __linux__
+    if (cpu_core >= 0) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(cpu_core, &cpuset);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    }
+#else
+    (void)cpu_core;
+#endif
+
+    oms::RingBuffer<MMQuote>& out = *quote_buffers_[shard];
+
+    // Shard 0 also runs the tick-rate rebalancer
+    uint64_t last_ticks[MAX_SYMBOLS] = {};
+    auto last_rebalance = std::chrono::steady_clock::now();
+
+    while (running_.load(std::memory_order_acquire)) {
+        bool did_work = false;
+
+        const size_t count = symbol_count_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            SymbolState& state = symbols_[i];
+            // Acquire pairs with the previous owner's release below, so
+            // becoming the owner also makes its last_quotes/last_valid
+            // writes visible
+            if (state.shard.load(std::memory_order_acquire) != shard) {
+                continue;
+            }
+            // Rebalancer wants this symbol elsewhere: hand it off here,
+            // between quoting passes, instead of letting the new owner
+            // start while we might still be mid-generate. Only the
+            // owner writes shard, so there is never a moment with two
+            // workers quoting the same symbol.
+            const uint16_t next = state.next_shard.load(std::memory_order_relaxed);
+            if (next != shard) {
+                state.shard.store(next, std::memory_order_release);
+                continue;
+            }
+            const uint64_t tick = state.tick_seq.load(std::memory_order_acquire);
+            if (tick == state.quoted_seq.load(std::memory_order_relaxed)) {
+                continue; // Nothing new since the last quote
+            }
+            state.quoted_seq.store(tick, std::memory_order_relaxed);
+            generateSymbolQuotes(state, out);
+            did_work = true;
+        }
+
+        if (shard == 0 && config_.rebalance_interval_ms > 0) {
+            auto now = std::chrono::steady_clock::now();
+            if (now - last_rebalance >=
+                std::chrono::milliseconds(config_.rebalance_interval_ms)) {
+                rebalanceShards(last_ticks);
+                last_rebalance = now;
+            }
+        }
+
+        if (!did_work) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void MarketMakerEngine::rebalanceShards(uint64_t* last_ticks) {
+    const size_t count = symbol_count_.load(std::memory_order_acquire);
+    const size_t num_shards = quote_buffers_.size();
+    if (count == 0 || num_shards < 2) {
+        return;
+    }
+
+    // Tick rate per symbol since the last rebalance
+    struct Load { uint64_t rate; size_t idx; };
+    std::vector<Load> loads;
+    loads.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t ticks = symbols_[i].tick_seq.load(std::memory_order_relaxed);
+        loads.push_back({ticks - last_ticks[i], i});
+        last_ticks[i] = ticks;
+    }
+
+    // Greedy longest-processing-time assignment: heaviest symbol goes
+    // to the currently lightest shard, so one hot symbol can't pin all
+    // its shard-mates behind it
+    std::sort(loads.begin(), loads.end(),
+              [](const Load& a, const Load& b) { return a.rate > b.rate; });
+
+    std::vector<uint64_t> shard_load(num_shards, 0);
+    for (const Load& load : loads) {
+        size_t lightest = 0;
+        for (size_t shard = 1; shard < num_shards; ++shard) {
+            if (shard_load[shard] < shard_load[lightest]) {
+                lightest = shard;
+            }
+        }
+        shard_load[lightest] += load.rate;
+        // Publish the desired placement only; the current owner
+        // performs the actual handoff between quoting passes
+        symbols_[load.idx].next_shard.store(static_cast<uint16_t>(lightest),
+                                            std::memory_order_relaxed);
+    }
+}
+
+void MarketMakerEngine::generateSymbolQuotes(SymbolState& state,
+                                             oms::RingBuffer<MMQuote>& out) {
+    MarketSnapshot market = state.market.Load();
+    InventorySnapshot inventory = state.inventory.Load();
     
     // Skip if no market data
     if (market.mid_price <= 0 || market.bid_price <= 0 || market.ask_price <= 0) {
@@ -70,37 +239,102 @@ void MarketMakerEngine::generateQuotes() {
     
     // Calculate dynamic spread
     double spread = calculateSpread(market, inventory);
+    double inventory_ratio = inventory.position / config_.max_inventory;
     
-    // Clear existing quotes
-    active_quotes_.store(0);
-    
-    // Generate quotes for each level
+    // Compute the desired book, then diff against what was last
+    // emitted: unchanged levels cost no exchange traffic
+    const double price_tol = market.mid_price * config_.requote_price_tolerance_bps / 10000.0;
+    const double size_tol = config_.quote_size * config_.requote_size_tolerance;
+
+    uint32_t new_valid = 0;
+    MMQuote quote;
     for (int level = 0; level < config_.quote_levels; ++level) {
-        // Bid quote
-        generateQuoteLevel("BTCUSDT", Side::BUY, market.mid_price, spread, level);
-        
-        // Ask quote  
-        generateQuoteLevel("BTCUSDT", Side::SELL, market.mid_price, spread, level);
+        for (int side_idx = 0; side_idx < 2; ++side_idx) {
+            const Side side = side_idx == 0 ? Side::BUY : Side::SELL;
+            const size_t slot = static_cast<size_t>(level) * 2 + side_idx;
+            if (slot >= MAX_QUOTES) {
+                break;
+            }
+
+            buildQuote(quote, state.symbol, side, market.mid_price, spread,
+                       level, inventory_ratio);
+
+            if (state.last_valid & (1u << slot)) {
+                const MMQuote& prev = state.last_quotes[slot];
+                if (std::abs(quote.price - prev.price) <= price_tol &&
+                    std::abs(quote.quantity - prev.quantity) <= size_tol) {
+                    // Within tolerance: the resting order stands, and
+                    // later diffs keep comparing against it
+                    new_valid |= 1u << slot;
+                    continue;
+                }
+                quote.action = QuoteAction::AMEND;
+            } else {
+                quote.action = QuoteAction::ADD;
+            }
+
+            if (out.push(quote)) {
+                state.last_quotes[slot] = quote;
+                new_valid |= 1u << slot;
+                quotes_generated_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
     }
-    
-    // Push all quotes to ring buffer
-    size_t quote_count = active_quotes_.load();
-    for (size_t i = 0; i < quote_count; ++i) {
-        quote_buffer_.push(current_quotes_[i]);
-        quotes_generated_.fetch_add(1);
+
+    // Cancel levels that were resting but are no longer wanted
+    uint32_t stale = state.last_valid & ~new_valid;
+    while (stale != 0) {
+        const size_t slot = static_cast<size_t>(__builtin_ctz(stale));
+        stale &= stale - 1;
+
+        quote = state.last_quotes[slot];
+        quote.action = QuoteAction::CANCEL;
+        quote.timestamp_ns = getCurrentTimeNanos();
+        if (out.push(quote)) {
+            quotes_generated_.fetch_add(1, std::memory_order_relaxed);
+        }
     }
+
+    state.last_valid = new_valid;
+}
+
+bool MarketMakerEngine::getNextQuote(size_t shard, MMQuote& quote) {
+    return quote_buffers_[shard]->pop(quote);
 }
 
 bool MarketMakerEngine::getNextQuote(MMQuote& quote) {
-    return quote_buffer_.pop(quote);
+    for (auto& buffer : quote_buffers_) {
+        if (buffer->pop(quote)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void MarketMakerEngine::start() {
-    running_.store(true);
+    if (running_.exchange(true)) {
+        return; // Already running
+    }
+
+    for (size_t shard = 0; shard < quote_buffers_.size(); ++shard) {
+        const int core = shard < config_.worker_cores.size()
+                             ? config_.worker_cores[shard]
+                             : -1;
+        workers_.emplace_back([this, shard, core] { workerLoop(shard, core); });
+    }
 }
 
 void MarketMakerEngine::stop() {
-    running_.store(false);
+    if (!running_.exchange(false)) {
+        return; // Already stopped
+    }
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
 }
 
 double MarketMakerEngine::calculateSpread(const MarketSnapshot& market, const InventorySnapshot& inventory) {
@@ -110,7 +344,6 @@ double MarketMakerEngine::calculateSpread(const MarketSnapshot& market, const In
     double vol_factor = 1.0 + (market.volatility * config_.volatility_factor);
     
     // Inventory skew
-    double inventory_ratio = inventory.position / config_.max_inventory;
     double skew_factor = getInventorySkew(inventory.position);
     
     // Final spread
@@ -123,31 +356,24 @@ double MarketMakerEngine::calculateSpread(const MarketSnapshot& market, const In
     return std::max(min_spread, std::min(max_spread, spread));
 }
 
-double MarketMakerEngine::calculateVolatility() {
-    double sum = 0.0;
-    double sum_sq = 0.0;
-    int count = 0;
-    
-    // Calculate returns
-    std::vector<double> returns;
-    for (size_t i = 1; i < PRICE_HISTORY_SIZE; ++i) {
-        if (price_history_[i] > 0 && price_history_[i-1] > 0) {
-            double ret = std::log(price_history_[i] / price_history_[i-1]);
-            returns.push_back(ret);
-            sum += ret;
-            count++;
-        }
+double MarketMakerEngine::updateVolatility(SymbolState& state, double mid_price) {
+    if (mid_price <= 0) {
+        return std::sqrt(state.ewma_return_var);
     }
-    
-    if (count < 2) return 0.0;
-    
-    // Calculate standard deviation
-    double mean = sum / count;
-    for (double ret : returns) {
-        sum_sq += std::pow(ret - mean, 2);
+    if (state.last_mid <= 0) {
+        state.last_mid = mid_price;
+        return 0.0;
     }
-    
-    return std::sqrt(sum_sq / (count - 1));
+
+    // EWMA of squared log returns: one log, one multiply-add per tick.
+    // alpha sets the effective window (see MarketMakerConfig).
+    const double ret = std::log(mid_price / state.last_mid);
+    state.last_mid = mid_price;
+
+    const double alpha = config_.volatility_ewma_alpha;
+    state.ewma_return_var += alpha * (ret * ret - state.ewma_return_var);
+
+    return std::sqrt(state.ewma_return_var);
 }
 
 double MarketMakerEngine::getInventorySkew(double position) {
@@ -159,15 +385,9 @@ double MarketMakerEngine::getInventorySkew(double position) {
     return 1.0 + config_.inventory_skew * std::abs(inventory_ratio);
 }
 
-void MarketMakerEngine::generateQuoteLevel(const char* symbol, Side side, double mid_price, 
-                                          double spread, int level) {
-    size_t idx = active_quotes_.fetch_add(1);
-    if (idx >= MAX_QUOTES) {
-        active_quotes_.fetch_sub(1);
-        return;
-    }
-    
-    MMQuote& quote = current_quotes_[idx];
+void MarketMakerEngine::buildQuote(MMQuote& quote, const char* symbol, Side side,
+                                   double mid_price, double spread, int level,
+                                   double inventory_ratio) {
     strncpy(quote.symbol, symbol, sizeof(quote.symbol) - 1);
     strncpy(quote.exchange, "binance", sizeof(quote.exchange) - 1);
     quote.side = side;
@@ -185,9 +405,6 @@ void MarketMakerEngine::generateQuoteLevel(const char* symbol, Side side, double
     }
     
     // Apply inventory skew
-    InventorySnapshot inventory = inventory_state_;
-    double inventory_ratio = inventory.position / config_.max_inventory;
-    
     if (inventory_ratio > 0) {
         // Long position: make asks more aggressive, bids less aggressive
         if (side == Side::SELL) {
@@ -206,9 +423,7 @@ void MarketMakerEngine::generateQuoteLevel(const char* symbol, Side side, double
 }
 
 uint64_t MarketMakerEngine::getCurrentTimeNanos() const {
-    return std::chrono::duration_cast<std::chrono::nanoseconds>(
-        std::chrono::high_resolution_clock::now().time_since_epoch()
-    ).count();
+    return TscClock::NowNanos();
 }
 
 // SpreadCalculator implementation
@@ -0,0 +1,250 @@
+#include "strategies/triangular_detector.h"
+#include "tsc_clock.h"
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <limits>
+
+namespace oms {
+namespace strategies {
+
+TriangularDetector::TriangularDetector(const TriangularConfig& config,
+                                       oms::MPMCRingBuffer<ArbitrageOpportunity>& opportunity_buffer)
+    : config_(config), opportunity_buffer_(opportunity_buffer) {
+    for (auto& pair_idx : id_to_pair_) {
+        pair_idx.store(UINT16_MAX, std::memory_order_relaxed);
+    }
+}
+
+uint8_t TriangularDetector::internCurrency(const char* code) {
+    for (size_t i = 0; i < currency_count_; ++i) {
+        if (std::strcmp(currency_names_[i], code) == 0) {
+            return static_cast<uint8_t>(i);
+        }
+    }
+    if (currency_count_ >= MAX_CURRENCIES) {
+        return UINT8_MAX;
+    }
+    std::strncpy(currency_names_[currency_count_], code,
+                 sizeof(currency_names_[0]) - 1);
+    return static_cast<uint8_t>(currency_count_++);
+}
+
+bool TriangularDetector::addPair(const char* symbol, const char* base, const char* quote) {
+    if (pair_count_ >= MAX_PAIRS) {
+        return false;
+    }
+
+    const uint8_t base_idx = internCurrency(base);
+    const uint8_t quote_idx = internCurrency(quote);
+    if (base_idx == UINT8_MAX || quote_idx == UINT8_MAX) {
+        return false;
+    }
+
+    const SymbolId sid = SymbolRegistry::Instance().Intern(symbol);
+    if (sid == kInvalidSymbolId) {
+        return false;
+    }
+
+    Pair& pair = pairs_[pair_count_];
+    std::strncpy(pair.symbol, symbol, sizeof(pair.symbol) - 1);
+    pair.base = base_idx;
+    pair.quote = quote_idx;
+    id_to_pair_[sid].store(static_cast<uint16_t>(pair_count_),
+                           std::memory_order_release);
+    ++pair_count_;
+    return true;
+}
+
+void TriangularDetector::buildCycles() {
+    cycles_.clear();
+    for (auto& list : cycles_of_pair_) {
+        list.clear();
+    }
+
+    // Enumerate all pair triples whose currencies form a triangle:
+    // exactly three distinct currencies, each appearing on two pairs.
+    // O(pairs^3) but runs once at startup against a small universe.
+    for (size_t i = 0; i < pair_count_; ++i) {
+        for (size_t j = i + 1; j < pair_count_; ++j) {
+            for (size_t k = j + 1; k < pair_count_; ++k) {
+                int degree[MAX_CURRENCIES] = {};
+                degree[pairs_[i].base]++;
+                degree[pairs_[i].quote]++;
+                degree[pairs_[j].base]++;
+                degree[pairs_[j].quote]++;
+                degree[pairs_[k].base]++;
+                degree[pairs_[k].quote]++;
+
+                int distinct = 0;
+                bool triangle = true;
+                for (size_t c = 0; c < currency_count_; ++c) {
+                    if (degree[c] == 0) continue;
+                    if (degree[c] != 2) { triangle = false; break; }
+                    ++distinct;
+                }
+                if (!triangle || distinct != 3) {
+                    continue;
+                }
+
+                Cycle cycle;
+                cycle.pairs[0] = static_cast<uint16_t>(i);
+                cycle.pairs[1] = static_cast<uint16_t>(j);
+                cycle.pairs[2] = static_cast<uint16_t>(k);
+                // Start from the quote of the first pair (typically the
+                // stable currency, e.g. USDT for BTCUSDT)
+                cycle.start_currency = pairs_[i].quote;
+
+                const uint16_t cycle_idx = static_cast<uint16_t>(cycles_.size());
+                cycles_.push_back(cycle);
+                cycles_of_pair_[i].push_back(cycle_idx);
+                cycles_of_pair_[j].push_back(cycle_idx);
+                cycles_of_pair_[k].push_back(cycle_idx);
+            }
+        }
+    }
+}
+
+void TriangularDetector::updatePriceFeed(const char* symbol,
+                                         double bid_price, double bid_quantity,
+                                         double ask_price, double ask_quantity) {
+    const SymbolId sid = SymbolRegistry::Instance().Lookup(symbol);
+    if (sid == kInvalidSymbolId) {
+        return; // Pair was never registered
+    }
+    const uint16_t pair_idx = id_to_pair_[sid].load(std::memory_order_acquire);
+    if (pair_idx == UINT16_MAX) {
+        return;
+    }
+
+    PairQuote top;
+    top.bid = bid_price;
+    top.ask = ask_price;
+    top.bid_qty = bid_quantity;
+    top.ask_qty = ask_quantity;
+    top.timestamp_ns = getCurrentTimeNanos();
+    pairs_[pair_idx].top.Store(top);
+
+    if (!running_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    // Incremental evaluation: only cycles this pair participates in
+    for (uint16_t cycle_idx : cycles_of_pair_[pair_idx]) {
+        evaluateCycle(cycles_[cycle_idx], top.timestamp_ns);
+    }
+}
+
+void TriangularDetector::evaluateCycle(const Cycle& cycle, uint64_t now) {
+    constexpr uint64_t kStaleNs = 1000000000;
+
+    PairQuote quotes[3];
+    for (int leg = 0; leg < 3; ++leg) {
+        quotes[leg] = pairs_[cycle.pairs[leg]].top.Load();
+        if (quotes[leg].bid <= 0 || quotes[leg].ask <= 0 ||
+            now - quotes[leg].timestamp_ns > kStaleNs) {
+            return; // A leg is unset or stale
+        }
+    }
+
+    evaluateDirection(cycle, quotes, false, now);
+    evaluateDirection(cycle, quotes, true, now);
+    evaluated_cycles_.fetch_add(2, std::memory_order_relaxed);
+}
+
+void TriangularDetector::evaluateDirection(const Cycle& cycle, const PairQuote* quotes,
+                                           bool reverse, uint64_t now) {
+    const double fee_keep = 1.0 - config_.taker_fee;
+
+    // Walk the triangle converting one unit of the start currency,
+    // tracking both the multiplicative rate and the tightest leg
+    // capacity expressed in start-currency units
+    uint8_t currency = cycle.start_currency;
+    double rate = 1.0;
+    double max_start = std::numeric_limits<double>::infinity();
+
+    // The three pairs form a triangle, so from any currency exactly one
+    // unvisited pair continues the walk
+    bool used[3] = {false, false, false};
+    for (int step = 0; step < 3; ++step) {
+        int leg = -1;
+        for (int l = 0; l < 3; ++l) {
+            const int candidate = reverse ? 2 - l : l;
+            if (used[candidate]) continue;
+            const Pair& pair = pairs_[cycle.pairs[candidate]];
+            if (pair.base == currency || pair.quote == currency) {
+                leg = candidate;
+                break;
+            }
+        }
+        if (leg < 0) {
+            return; // Defensive: graph construction guarantees a leg
+        }
+        used[leg] = true;
+
+        const Pair& pair = pairs_[cycle.pairs[leg]];
+        const PairQuote& top = quotes[leg];
+
+        if (pair.base == currency) {
+            // Sell base at the bid; capacity is the bid size in base units
+            max_start = std::min(max_start, top.bid_qty / rate);
+            rate *= top.bid * fee_keep;
+            currency = pair.quote;
+        } else {
+            // Buy base at the ask; capacity is the ask size in quote units
+            max_start = std::min(max_start, top.ask_qty * top.ask / rate);
+            rate *= fee_keep / top.ask;
+            currency = pair.base;
+        }
+    }
+
+    const double profit_rate = rate - 1.0;
+    if (profit_rate < config_.min_profit_rate) {
+        return;
+    }
+
+    double start_size = std::min(max_start, config_.max_position_size);
+    const double net_profit = start_size * profit_rate;
+    if (net_profit < config_.min_profit_amount) {
+        return;
+    }
+
+    ArbitrageOpportunity opportunity;
+    std::snprintf(opportunity.id, sizeof(opportunity.id), "TRI_%s_%s_%s_%llu",
+                  pairs_[cycle.pairs[0]].symbol,
+                  pairs_[cycle.pairs[1]].symbol,
+                  pairs_[cycle.pairs[2]].symbol,
+                  static_cast<unsigned long long>(now));
+    std::snprintf(opportunity.symbol, sizeof(opportunity.symbol), "%s",
+                  currency_names_[cycle.start_currency]);
+    std::strncpy(opportunity.buy_exchange, config_.exchange.c_str(),
+                 sizeof(opportunity.buy_exchange) - 1);
+    std::strncpy(opportunity.sell_exchange, config_.exchange.c_str(),
+                 sizeof(opportunity.sell_exchange) - 1);
+    opportunity.buy_price = 0;
+    opportunity.sell_price = 0;
+    opportunity.max_quantity = start_size;
+    opportunity.profit_rate = profit_rate;
+    opportunity.net_profit = net_profit;
+    opportunity.detected_at_ns = now;
+    opportunity.valid_until_ns = now + config_.opportunity_ttl_ns;
+
+    if (opportunity_buffer_.push(opportunity)) {
+        detected_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void TriangularDetector::start() {
+    running_.store(true, std::memory_order_release);
+}
+
+void TriangularDetector::stop() {
+    running_.store(false, std::memory_order_release);
+}
+
+uint64_t TriangularDetector::getCurrentTimeNanos() const {
+    return TscClock::NowNanos();
+}
+
+} // namespace strategies
+} // namespace oms
@@ -22,8 +22,8 @@ void test_risk_engine_basic() {
     Order order1;
     order1.symbol = "BTCUSDT";
     order1.side = Side::BUY;
-    order1.price = 40000.0;
-    order1.quantity = 0.1;  // Value = 4000
+    order1.price = Px::FromDouble(40000.0);
+    order1.quantity = Qty::FromDouble(0.1);  // Value = 4000
     
     assert(engine.checkOrder(order1) == true);
     std::cout << "✓ Valid order passed" << std::endl;
@@ -32,8 +32,8 @@ void test_risk_engine_basic() {
     Order order2;
     order2.symbol = "BTCUSDT";
     order2.side = Side::BUY;
-    order2.price = 40000.0;
-    order2.quantity = 0.5;  // Value = 20000, exceeds limit
+    order2.price = Px::FromDouble(40000.0);
+    order2.quantity = Qty::FromDouble(0.5);  // Value = 20000, exceeds limit
     
     assert(engine.checkOrder(order2) == false);
     std::cout << "✓ Over-limit order rejected" << std::endl;
@@ -52,8 +52,8 @@ void test_risk_engine_performance() {
     Order order;
     order.symbol = "BTCUSDT";
     order.side = Side::BUY;
-    order.price = 40000.0;
-    order.quantity = 0.01;
+    order.price = Px::FromDouble(40000.0);
+    order.quantity = Qty::FromDouble(0.01);
     
     auto start = std::chrono::high_resolution_clock::now();
     